@@ -0,0 +1,31 @@
+-- Recursion, a counted loop, constant arithmetic and comparisons in
+-- predicates: the arithmetic program of icount.sh.
+
+class Main inherits IO {
+  x : Int <- 5;
+  fact(n : Int) : Int { if n = 0 then 1 else n * fact(n - 1) fi };
+  fib(n : Int) : Int { if n < 2 then n else fib(n - 1) + fib(n - 2) fi };
+  sum(n : Int) : Int {
+    let i : Int <- 0, s : Int <- 0 in {
+      while i <= n loop { s <- s + i; i <- i + 1; } pool;
+      s;
+    }
+  };
+  main() : Object {{
+    out_int(fact(10)); out_string("\n");
+    out_int(fib(15)); out_string("\n");
+    out_int(sum(100)); out_string("\n");
+    out_int(2 * 60 * 60); out_string("\n");
+    out_int(~7 + 100 / 7 - 3); out_string("\n");
+    out_int(x); out_string("\n");
+    x <- x * 3;
+    out_int(x); out_string("\n");
+    if not (x < 10) then out_string("big\n") else out_string("small\n") fi;
+    if x <= 15 then out_string("le\n") else out_string("gt\n") fi;
+    if 3 = 3 then out_string("eq\n") else out_string("ne\n") fi;
+    if "ab" = "ab" then out_string("seq\n") else out_string("sne\n") fi;
+    if true then out_string("t\n") else out_string("f\n") fi;
+    if not false then out_string("t\n") else out_string("f\n") fi;
+    let y : Int <- 10 in let z : Int <- y + 1 in { y <- y + z; out_int(y); out_string("\n"); };
+  }};
+};
@@ -0,0 +1,157 @@
+#!/bin/sh
+#
+# bench.sh: compiler scaling benchmark.
+#
+# Generates programs of geometrically growing size with coolgen, runs
+# every phase of the compiler on its own (lexer, parser, semant, cgen
+# from pa2..pa5, each reading the saved output of the previous phase),
+# and reports the wall time and peak memory of every phase per size
+# together with the scaling exponent between consecutive sizes:
+#
+#     exponent = log(t2 / t1) / log(n2 / n1)
+#
+# so a linear phase shows about 1 and a quadratic one about 2.
+#
+#     ./bench.sh [-b baseclasses] [-n steps] [-r reps] [-k] [-- coolgen options]
+#
+#     -b N    classes in the smallest program            [25]
+#     -n N    number of sizes, each twice the previous   [6]
+#     -r N    runs per phase and size, the best is kept  [3]
+#     -k      keep the generated programs and phase outputs
+#
+# Everything after -- is passed to coolgen (see coolgen.cc), e.g.
+#
+#     ./bench.sh -b 50 -n 5 -- -d 8 -m 10 -e 6
+#
+# The phases are instrumented with common/time-report.h, so time and peak RSS
+# come from COOL_TIME_REPORT; cgen flags can be given in CGENFLAGS.
+#
+
+BENCH=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(dirname "$BENCH")
+LEXER=${LEXER:-$ROOT/pa2/lexer}
+PARSER=${PARSER:-$ROOT/pa3/parser}
+SEMANT=${SEMANT:-$ROOT/pa4/semant}
+CGEN=${CGEN:-$ROOT/pa5/cgen}
+CXX=${CXX:-g++}
+
+base=25
+steps=6
+reps=3
+keep=0
+
+while getopts "b:n:r:k" opt; do
+	case $opt in
+	b) base=$OPTARG ;;
+	n) steps=$OPTARG ;;
+	r) reps=$OPTARG ;;
+	k) keep=1 ;;
+	*) sed -n '2,/^$/s/^# \{0,1\}//p' "$0" >&2; exit 1 ;;
+	esac
+done
+shift $((OPTIND - 1))
+
+for p in "$LEXER" "$PARSER" "$SEMANT" "$CGEN"; do
+	if [ ! -x "$p" ]; then
+		echo "bench.sh: $p not built" >&2
+		exit 1
+	fi
+done
+
+if [ ! -x "$BENCH/coolgen" ] || [ "$BENCH/coolgen.cc" -nt "$BENCH/coolgen" ]; then
+	$CXX -O2 -o "$BENCH/coolgen" "$BENCH/coolgen.cc" || exit 1
+fi
+
+work=$(mktemp -d "${TMPDIR:-/tmp}/coolbench.XXXXXX")
+[ $keep -eq 1 ] || trap 'rm -rf "$work"' EXIT
+
+# run_phase phase input: runs one phase on input, writing to stdout.
+# The lexer takes the file names as arguments, the later phases read
+# the previous phase's output on stdin.
+run_phase() {
+	case $1 in
+	lexer)  "$LEXER" "$2" ;;
+	parser) "$PARSER" < "$2" ;;
+	semant) "$SEMANT" < "$2" ;;
+	cgen)   $CGEN $CGENFLAGS < "$2" ;;
+	esac
+}
+
+# best_of phase input output: runs the phase $reps times and prints
+# "wall_ms peak_rss_kb" of the fastest run.
+best_of() {
+	phase=$1; in=$2; out=$3
+	best=
+	i=0
+	while [ $i -lt $reps ]; do
+		rm -f "$work/report.json"
+		COOL_TIME_REPORT="$work/report.json" run_phase $phase "$in" > "$out" 2>/dev/null ||
+			{ echo "bench.sh: $phase failed on $in" >&2; exit 1; }
+		[ -s "$out" ] ||
+			{ echo "bench.sh: $phase wrote nothing for $in" >&2; exit 1; }
+		# Sum the top level steps of the process, keep the largest RSS.
+		run=$(awk '{
+			n = split($0, step, /\{"name"/)
+			for (j = 2; j <= n; j++) {
+				if (step[j] !~ /"depth": 0,/) continue
+				match(step[j], /"wall_ms": [0-9.]+/)
+				wall += substr(step[j], RSTART + 11, RLENGTH - 11)
+				match(step[j], /"peak_rss_kb": [0-9]+/)
+				rss = substr(step[j], RSTART + 15, RLENGTH - 15) + 0
+				if (rss > peak) peak = rss
+			}
+		} END { printf "%.3f %d\n", wall, peak }' "$work/report.json")
+		best=$(printf '%s\n%s\n' "$best" "$run" | awk 'NF' | sort -n | head -1)
+		i=$((i + 1))
+	done
+	echo "$best"
+}
+
+results="$work/results"
+: > "$results"
+classes=$base
+s=0
+while [ $s -lt $steps ]; do
+	prog="$work/c$classes.cl"
+	"$BENCH/coolgen" -c $classes "$@" > "$prog" || exit 1
+	lines=$(wc -l < "$prog")
+
+	lex=$(best_of lexer "$prog" "$prog.lex") || exit 1
+	parse=$(best_of parser "$prog.lex" "$prog.ast") || exit 1
+	sem=$(best_of semant "$prog.ast" "$prog.sem") || exit 1
+	cg=$(best_of cgen "$prog.sem" "$prog.s") || exit 1
+
+	echo "$classes $lines $lex $parse $sem $cg" >> "$results"
+	classes=$((classes * 2))
+	s=$((s + 1))
+done
+
+awk '
+BEGIN {
+	split("lexer parser semant cgen", name)
+	printf "%8s %8s", "classes", "lines"
+	for (p = 1; p <= 4; p++) printf " %10s %9s %6s", name[p] " ms", "RSS kB", "exp"
+	printf "\n"
+}
+{
+	printf "%8d %8d", $1, $2
+	for (p = 1; p <= 4; p++) {
+		t = $(2 * p + 1); m = $(2 * p + 2)
+		if (NR > 1 && t > 0 && prev[p] > 0) {
+			e = log(t / prev[p]) / log($2 / prevlines)
+			printf " %10.2f %9d %6.2f", t, m, e
+			if (e > worst[p]) worst[p] = e
+		} else
+			printf " %10.2f %9d %6s", t, m, "-"
+		prev[p] = t
+	}
+	prevlines = $2
+	printf "\n"
+}
+END {
+	for (p = 1; p <= 4; p++)
+		if (worst[p] >= 1.5)
+			printf "%s: superlinear, exponent up to %.2f\n", name[p], worst[p]
+}' "$results"
+
+[ $keep -eq 0 ] || echo "kept in $work"
@@ -0,0 +1,237 @@
+//
+// coolgen.cc
+//
+// Generates large, valid COOL programs for compiler scaling benchmarks.
+//
+//     g++ -O2 -o coolgen coolgen.cc
+//     ./coolgen -c 200 -d 5 -m 8 -e 6 -l 0.4 -f 6 -S 42 > big.cl
+//
+// Options (defaults in brackets):
+//     -c N    number of classes                                [50]
+//     -d N    maximum inheritance depth                        [4]
+//     -m N    methods per class                                [5]
+//     -a N    Int attributes per class                         [3]
+//     -e N    maximum expression depth of a method body        [5]
+//     -l P    probability that an expression leaf is a literal [0.3]
+//     -f N    branches of the case expression in each class    [4]
+//     -L N    lets nested in Main.deep, 0 for no such method   [0]
+//     -S N    random seed                                      [1]
+//
+// Classes are laid out as chains: C<i> inherits from C<i-1> unless i is
+// a multiple of the depth, in which case it starts a new chain under
+// IO.  Every class gets Int attributes with literal initializers, a
+// `sel' method holding a case expression over distinct classes, and
+// methods whose bodies are random Int expressions.  A method only calls
+// methods defined before it (in its own class or an ancestor), so the
+// generated program always terminates, and divisions are only by
+// non-zero literals.
+//
+// -L adds a method whose body is a chain of N nested lets, each
+// reading the variable of the one before, to measure how the scoped
+// environments of semant and cgen cope with deep nesting.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <random>
+#include <string>
+#include <vector>
+
+struct Options
+{
+	int classes = 50;
+	int depth = 4;
+	int methods = 5;
+	int attrs = 3;
+	int expr_depth = 5;
+	double literal_density = 0.3;
+	int fanout = 4;
+	int let_depth = 0;
+	unsigned seed = 1;
+};
+
+struct ClassInfo
+{
+	int id;
+	int parent;        // -1 for IO
+	int chain_pos;     // 0 for the root of a chain
+};
+
+class Generator
+{
+	Options const& opt;
+	std::mt19937 rng;
+	std::vector<ClassInfo> classes;
+
+	// Variables visible in the body being generated.
+	std::vector<std::string> ints;
+	// Methods callable on self from the body being generated.
+	std::vector<std::string> callable;
+	int lets;
+
+	int pick(int n) { return std::uniform_int_distribution<int>(0, n - 1)(rng); }
+	bool chance(double p) { return std::uniform_real_distribution<double>(0, 1)(rng) < p; }
+
+	std::string name(int c) { return "C" + std::to_string(c); }
+	std::string literal() { return std::to_string(pick(1000)); }
+
+	std::string int_leaf()
+	{
+		if (ints.empty() || chance(opt.literal_density)) return literal();
+		return ints[pick(ints.size())];
+	}
+
+	std::string bool_expr(int d)
+	{
+		switch (pick(4)){
+		case 0:  return "(" + int_expr(d - 1) + " < " + int_expr(d - 1) + ")";
+		case 1:  return "(" + int_expr(d - 1) + " <= " + int_expr(d - 1) + ")";
+		case 2:  return "(" + int_expr(d - 1) + " = " + int_expr(d - 1) + ")";
+		default: return "(not " + bool_expr(d - 1) + ")";
+		}
+	}
+
+	std::string int_expr(int d)
+	{
+		if (d <= 0) return int_leaf();
+
+		switch (pick(9)){
+		case 0:  return "(" + int_expr(d - 1) + " + " + int_expr(d - 1) + ")";
+		case 1:  return "(" + int_expr(d - 1) + " - " + int_expr(d - 1) + ")";
+		case 2:  return "(" + int_expr(d - 1) + " * " + int_expr(d - 1) + ")";
+		case 3:  return "(" + int_expr(d - 1) + " / " + std::to_string(1 + pick(9)) + ")";
+		case 4:  return "(~" + int_expr(d - 1) + ")";
+		case 5:
+			return "(if " + bool_expr(d - 1) + " then " + int_expr(d - 1) +
+			       " else " + int_expr(d - 1) + " fi)";
+		case 6: {
+			std::string v = "l" + std::to_string(lets++);
+			std::string init = int_expr(d - 1);
+			ints.push_back(v);
+			std::string body = "{ " + v + " <- " + v + " + " + int_leaf() + "; " + int_expr(d - 1) + "; }";
+			ints.pop_back();
+			return "(let " + v + " : Int <- " + init + " in " + body + ")";
+		}
+		case 7:
+			if (!callable.empty())
+				return callable[pick(callable.size())] + "(" + int_expr(d - 1) + ", " + int_expr(d - 1) + ")";
+			return int_leaf();
+		default:
+			return "(sel(new " + name(pick(classes.size())) + "))";
+		}
+	}
+
+	void class_decl(ClassInfo const& c)
+	{
+		printf("class %s inherits %s {\n", name(c.id).c_str(),
+		       c.parent < 0 ? "IO" : name(c.parent).c_str());
+
+		for (int a = 0; a < opt.attrs; a++)
+			printf("    a%d_%d : Int <- %s;\n", c.id, a, literal().c_str());
+
+		// sel is declared by every chain root and overridden below it.
+		std::vector<int> targets;
+		for (int b = 0; b < opt.fanout && b < (int) classes.size(); b++){
+			int t = pick(classes.size());
+			bool seen = false;
+			for (int u : targets) seen = seen || u == t;
+			if (!seen) targets.push_back(t);
+		}
+		printf("    sel(o : Object) : Int {\n        case o of\n");
+		for (size_t b = 0; b < targets.size(); b++)
+			printf("            b%zu : %s => %s;\n", b, name(targets[b]).c_str(), literal().c_str());
+		printf("            other : Object => %d;\n        esac\n    };\n", c.id);
+
+		ints.clear();
+		for (int anc = c.id; anc >= 0; anc = classes[anc].parent)
+			for (int a = 0; a < opt.attrs; a++)
+				ints.push_back("a" + std::to_string(anc) + "_" + std::to_string(a));
+		size_t attr_count = ints.size();
+
+		for (int m = 0; m < opt.methods; m++){
+			std::string mname = "m" + std::to_string(c.id) + "_" + std::to_string(m);
+			ints.resize(attr_count);
+			ints.push_back("x");
+			ints.push_back("y");
+			lets = 0;
+			printf("    %s(x : Int, y : Int) : Int {\n        %s\n    };\n",
+			       mname.c_str(), int_expr(opt.expr_depth).c_str());
+			callable.push_back(mname);
+		}
+		printf("};\n\n");
+	}
+
+public:
+	Generator(Options const& o): opt(o), rng(o.seed)
+	{
+		for (int i = 0; i < opt.classes; i++){
+			ClassInfo c;
+			c.id = i;
+			c.chain_pos = (opt.depth > 0) ? i % opt.depth : 0;
+			c.parent = c.chain_pos == 0 ? -1 : i - 1;
+			classes.push_back(c);
+		}
+	}
+
+	void program()
+	{
+		printf("(* generated by coolgen: -c %d -d %d -m %d -a %d -e %d -l %g -f %d -L %d -S %u *)\n\n",
+		       opt.classes, opt.depth, opt.methods, opt.attrs, opt.expr_depth,
+		       opt.literal_density, opt.fanout, opt.let_depth, opt.seed);
+
+		for (auto const& c : classes){
+			// Methods of the ancestors stay callable down the chain.
+			if (c.chain_pos == 0) callable.clear();
+			class_decl(c);
+		}
+
+		printf("class Main inherits IO {\n");
+		if (opt.let_depth > 0){
+			printf("    deep(x : Int) : Int {\n        let v0 : Int <- x in\n");
+			for (int i = 1; i < opt.let_depth; i++)
+				printf("        let v%d : Int <- v%d + %d in\n", i, i - 1, 1 + pick(9));
+			printf("        v%d\n    };\n", opt.let_depth - 1);
+		}
+		printf("    main() : Object {{\n");
+		if (opt.let_depth > 0)
+			printf("        out_int(deep(0)); out_string(\"\\n\");\n");
+		for (auto const& c : classes)
+			if (opt.methods > 0)
+				printf("        out_int(new %s.m%d_%d(%d, %d)); out_string(\"\\n\");\n",
+				       name(c.id).c_str(), c.id, opt.methods - 1, c.id, c.id + 1);
+		printf("    }};\n};\n");
+	}
+};
+
+static void usage(char const *prog)
+{
+	fprintf(stderr, "usage: %s [-c classes] [-d depth] [-m methods] [-a attrs] "
+	        "[-e exprdepth] [-l literaldensity] [-f casefanout] [-L letdepth] [-S seed]\n", prog);
+	exit(1);
+}
+
+int main(int argc, char **argv)
+{
+	Options opt;
+	int c;
+
+	while ((c = getopt(argc, argv, "c:d:m:a:e:l:f:L:S:")) != -1){
+		switch (c){
+		case 'c': opt.classes = atoi(optarg); break;
+		case 'd': opt.depth = atoi(optarg); break;
+		case 'm': opt.methods = atoi(optarg); break;
+		case 'a': opt.attrs = atoi(optarg); break;
+		case 'e': opt.expr_depth = atoi(optarg); break;
+		case 'l': opt.literal_density = atof(optarg); break;
+		case 'f': opt.fanout = atoi(optarg); break;
+		case 'L': opt.let_depth = atoi(optarg); break;
+		case 'S': opt.seed = strtoul(optarg, NULL, 10); break;
+		default: usage(argv[0]);
+		}
+	}
+	if (opt.classes < 1 || opt.depth < 1) usage(argv[0]);
+
+	Generator(opt).program();
+	return 0;
+}
@@ -0,0 +1,80 @@
+#!/bin/sh
+#
+# icount.sh: dynamic instruction counts of the generated code.
+#
+# Compiles every program with the phases from pa2..pa5, once with the
+# peephole pass off (COOL_PEEPHOLE=0) and once with it on, runs both
+# with mipsim.py and reports the instructions executed, off -> on:
+#
+#     ./icount.sh [-f "cgen flags"] [file.cl ...]
+#
+# Without files it counts arith.cl and loops.cl from this directory and
+# test2.cl, dispatch-override-static.cl and shadow-formal-let.cl from
+# pa5, the programs the figures in the history were taken on.  A
+# program whose output differs between the two runs, or that faults in
+# the simulator, is reported and makes the script fail.
+#
+# mipsim.py runs the runtime routines natively and counts each as one
+# instruction (see there), so the counts are not spim's; they compare
+# code generators, not machines.
+#
+
+BENCH=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(dirname "$BENCH")
+LEXER=${LEXER:-$ROOT/pa2/lexer}
+PARSER=${PARSER:-$ROOT/pa3/parser}
+SEMANT=${SEMANT:-$ROOT/pa4/semant}
+CGEN=${CGEN:-$ROOT/pa5/cgen}
+PYTHON=${PYTHON:-python3}
+
+flags=
+
+while getopts "f:" opt; do
+	case $opt in
+	f) flags=$OPTARG ;;
+	*) sed -n '2,/^$/s/^# \{0,1\}//p' "$0" >&2; exit 1 ;;
+	esac
+done
+shift $((OPTIND - 1))
+
+if [ $# -eq 0 ]; then
+	set -- "$BENCH/arith.cl" "$BENCH/loops.cl" "$ROOT/pa5/test2.cl" \
+		"$ROOT/pa5/dispatch-override-static.cl" "$ROOT/pa5/shadow-formal-let.cl"
+fi
+
+for p in "$LEXER" "$PARSER" "$SEMANT" "$CGEN"; do
+	if [ ! -x "$p" ]; then
+		echo "icount.sh: $p not built" >&2
+		exit 1
+	fi
+done
+
+work=$(mktemp -d "${TMPDIR:-/tmp}/icount.XXXXXX")
+trap 'rm -rf "$work"' EXIT
+
+# count peephole file.cl: compiles and runs the program, leaving its
+# output in $work/out.$peephole and printing the instruction count.
+count() {
+	"$LEXER" "$2" | "$PARSER" | "$SEMANT" > "$work/sem" ||
+		{ echo "icount.sh: $2 does not compile" >&2; return 1; }
+	COOL_PEEPHOLE=$1 $CGEN $flags < "$work/sem" > "$work/s" ||
+		{ echo "icount.sh: cgen failed on $2" >&2; return 1; }
+	"$PYTHON" "$BENCH/mipsim.py" "$work/s" < /dev/null > "$work/out.$1" 2> "$work/err" ||
+		{ echo "icount.sh: $2 faults:" >&2; tail -1 "$work/out.$1" >&2; return 1; }
+	sed -n 's/^instructions: \([0-9]*\).*/\1/p' "$work/err"
+}
+
+status=0
+for f in "$@"; do
+	off=$(count 0 "$f") || { status=1; continue; }
+	on=$(count 1 "$f") || { status=1; continue; }
+	if ! cmp -s "$work/out.0" "$work/out.1"; then
+		echo "icount.sh: the peephole pass changes the output of $f" >&2
+		status=1
+	fi
+	echo "$(basename "$f" .cl) $off $on" >> "$work/counts"
+done
+
+[ -s "$work/counts" ] && awk '{ printf "  %-24s %9d -> %9d  (%+.1f%%)\n", $1, $2, $3, 100 * ($3 - $2) / $2 }' "$work/counts"
+
+exit $status
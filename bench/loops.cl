@@ -0,0 +1,22 @@
+-- A loop with an attribute update through dispatch and a nested
+-- countdown: the loop program of icount.sh.
+
+class Counter {
+  n : Int <- 0;
+  inc() : Int { n <- n + 1 };
+  get() : Int { n };
+};
+class Main inherits IO {
+  main() : Object {
+    let c : Counter <- new Counter, i : Int <- 0, acc : Int <- 0 in {
+      while i < 50 loop {
+        c.inc();
+        if i - (i / 3) * 3 = 0 then acc <- acc + i else acc <- acc - 1 fi;
+        i <- i + 1;
+      } pool;
+      out_int(c.get()); out_string(" "); out_int(acc); out_string("\n");
+      let j : Int <- 10 in while 0 < j loop j <- j - 1 pool;
+      out_string("done\n");
+    }
+  };
+};
@@ -0,0 +1,491 @@
+#!/usr/bin/env python3
+#
+# mipsim.py: instruction counting MIPS simulator for cgen output.
+#
+# Runs the assembly cgen writes, with the COOL runtime of trap.handler
+# (Object.copy, the IO methods, String methods, equality_test, the
+# aborts and the collector entry points) implemented natively, and
+# reports the number of instructions of the generated code it executed:
+#
+#     ./mipsim.py foo.s < input
+#
+# The program's output, with the runtime's messages, goes to stdout as
+# spim prints it after its banner, and "instructions: N allocs: M" to
+# stderr.  A runtime routine counts as its jal only, so the counts
+# measure the code cgen emits, which is what the peephole pass and the
+# -O passes change.  spim cannot count instructions; use it to check
+# that the output is the same.
+#
+# Beyond spim the simulator faults when the program breaks a runtime
+# invariant: a store into an object older than the last allocation of a
+# pointer to a newer one that was not passed to _GenGC_Assign before the
+# next allocation (with the generational collector only), or a changed
+# heap limit in $s7 at an allocation.
+#
+
+import re
+import struct
+import sys
+
+REGS = {'$zero': 0, '$at': 1, '$v0': 2, '$v1': 3, '$a0': 4, '$a1': 5, '$a2': 6, '$a3': 7,
+        '$t0': 8, '$t1': 9, '$t2': 10, '$t3': 11, '$t4': 12, '$t5': 13, '$t6': 14, '$t7': 15,
+        '$s0': 16, '$s1': 17, '$s2': 18, '$s3': 19, '$s4': 20, '$s5': 21, '$s6': 22, '$s7': 23,
+        '$t8': 24, '$t9': 25, '$k0': 26, '$k1': 27, '$gp': 28, '$sp': 29, '$fp': 30, '$ra': 31}
+GP, SP, RA, LIMIT = 28, 29, 31, 23
+
+MEMSIZE = 64 << 20
+DATA = 0x10000
+TEXT = MEMSIZE - (1 << 24)              # text addresses, one word per instruction
+STACKTOP = TEXT - (1 << 16)
+RETMAGIC = TEXT - 4                     # $ra of the entry points
+
+RUNTIME = sorted([
+    'Object.copy', 'Object.abort', 'Object.type_name',
+    'IO.out_string', 'IO.out_int', 'IO.in_string', 'IO.in_int',
+    'String.length', 'String.concat', 'String.substr', 'equality_test',
+    '_dispatch_abort', '_case_abort', '_case_abort2', '_gc_check', '_GenGC_Assign',
+    '_NoGC_Init', '_GenGC_Init', '_ScnGC_Init', '_NoGC_Collect', '_GenGC_Collect',
+    '_ScnGC_Collect', '_MemMgr_Alloc'])
+
+
+class Exit(Exception):
+    pass
+
+
+class Fault(Exception):
+    pass
+
+
+def s32(x):
+    x &= 0xffffffff
+    return x - (1 << 32) if x & 0x80000000 else x
+
+
+def strip_comment(line):
+    quoted = False
+    for k, ch in enumerate(line):
+        if ch == '"':
+            quoted = not quoted
+        elif ch == '#' and not quoted:
+            return line[:k]
+    return line
+
+
+class VM:
+    def __init__(self, text, stdin):
+        self.mem = bytearray(MEMSIZE)
+        self.r = [0] * 32
+        self.labels = {}        # data labels to addresses, text labels to ('T', index)
+        self.code = []          # (op, args, source line)
+        self.out = []
+        self.stdin = stdin.split('\n')
+        self.count = 0
+        self.allocs = 0
+        self.assemble(text)
+
+    def w(self, a):
+        if a < 0x1000 or a + 4 > MEMSIZE or a & 3:
+            raise Fault('bad load %#x' % a)
+        return s32(struct.unpack_from('<I', self.mem, a)[0])
+
+    def sw(self, a, v):
+        if a < 0x1000 or a + 4 > MEMSIZE or a & 3:
+            raise Fault('bad store %#x' % a)
+        struct.pack_into('<I', self.mem, a, v & 0xffffffff)
+
+    def assemble(self, text):
+        seg = 'text'
+        dp = DATA
+        fixups = []
+        for ln in text.split('\n'):
+            s = strip_comment(ln).strip()
+            while s:
+                m = re.match(r'^([A-Za-z_$.][\w$.]*):\s*(.*)$', s)
+                if not m:
+                    break
+                self.labels[m.group(1)] = dp if seg == 'data' else ('T', len(self.code))
+                s = m.group(2).strip()
+            if not s:
+                continue
+            parts = s.split(None, 1)
+            op = parts[0]
+            rest = parts[1] if len(parts) > 1 else ''
+            if op == '.data':
+                seg = 'data'
+            elif op == '.text':
+                seg = 'text'
+            elif op == '.globl':
+                pass
+            elif op == '.align':
+                a = 1 << int(rest)
+                dp = (dp + a - 1) & ~(a - 1)
+            elif op == '.word':
+                for v in rest.split(','):
+                    v = v.strip()
+                    if re.match(r'^-?\d+$', v):
+                        self.sw(dp, int(v))
+                    else:
+                        fixups.append((dp, v))
+                    dp += 4
+            elif op == '.byte':
+                for v in rest.split(','):
+                    self.mem[dp] = int(v.strip()) & 0xff
+                    dp += 1
+            elif op in ('.ascii', '.asciiz'):
+                b = bytes(rest.strip()[1:-1], 'latin1').decode('unicode_escape').encode('latin1')
+                self.mem[dp:dp + len(b)] = b
+                dp += len(b)
+                if op == '.asciiz':
+                    self.mem[dp] = 0
+                    dp += 1
+            elif seg == 'data':
+                raise Exception('unknown data directive ' + s)
+            else:
+                args = [a for a in re.split(r'[,\s]+', rest.strip()) if a]
+                self.code.append((op, args, ln))
+
+        self.heap_start = (dp + 0x1000) & ~3
+        self.limit = STACKTOP - (12 << 20)
+        self.r[GP] = self.heap_start
+        self.r[LIMIT] = self.limit
+        self.old = self.heap_start      # objects below were allocated before the last allocation
+        self.pending = set()            # stores of newer pointers into older objects
+        for a, v in fixups:
+            if v in self.labels:
+                self.sw(a, self.addr(v))
+            elif v in RUNTIME:
+                self.sw(a, self.runtime_addr(v))
+            else:
+                raise Exception('undefined label in .word: ' + v)
+
+    # Runtime routines get text addresses after the program's code.
+    def runtime_addr(self, name):
+        return TEXT + 4 * (len(self.code) + RUNTIME.index(name))
+
+    def addr(self, name):
+        L = self.labels.get(name)
+        if L is None:
+            raise Exception('undefined label ' + name)
+        return TEXT + 4 * L[1] if isinstance(L, tuple) else L
+
+    # The instruction index of a jump target, or ('R', name) for the runtime.
+    def target(self, name):
+        if name in RUNTIME and name not in self.labels:
+            return ('R', name)
+        L = self.labels.get(name)
+        if L is None:
+            raise Exception('undefined label ' + name)
+        if not isinstance(L, tuple):
+            raise Exception('jump to data ' + name)
+        return L[1]
+
+    def alloc(self, nwords):
+        if self.r[LIMIT] != self.limit:
+            raise Fault('limit pointer $s7 clobbered')
+        if self.pending:
+            raise Fault('missing write barrier for %s' % ['%#x' % x for x in self.pending])
+        self.old = self.r[GP]
+        a = self.r[GP]
+        self.r[GP] += 4 * nwords
+        self.allocs += 1
+        if self.r[GP] >= self.limit:
+            raise Fault('heap exhausted')
+        return a
+
+    def copy(self, obj):
+        if obj == 0:
+            raise Fault('copy of void')
+        size = self.w(obj + 4)
+        a = self.alloc(size + 1) + 4
+        self.sw(a - 4, -1)
+        self.mem[a:a + 4 * size] = self.mem[obj:obj + 4 * size]
+        return a
+
+    def tag(self, name):
+        return self.w(self.addr(name))
+
+    def int_of(self, o):
+        return self.w(o + 12)
+
+    def str_of(self, o):
+        n = self.int_of(self.w(o + 12))
+        return bytes(self.mem[o + 16:o + 16 + n]).decode('latin1')
+
+    def new_int(self, v):
+        o = self.copy(self.addr('Int_protObj'))
+        self.sw(o + 12, v)
+        return o
+
+    def new_str(self, s):
+        b = s.encode('latin1')
+        words = 4 + (len(b) + 4) // 4
+        a = self.alloc(words + 1) + 4
+        self.sw(a - 4, -1)
+        self.sw(a, self.tag('_string_tag'))
+        self.sw(a + 4, words)
+        self.sw(a + 8, self.addr('String_dispTab'))
+        self.sw(a + 12, self.new_int(len(b)))
+        self.mem[a + 16:a + 16 + len(b)] = b
+        self.mem[a + 16 + len(b)] = 0
+        return a
+
+    def classname(self, o):
+        try:
+            return self.str_of(self.w(self.addr('class_nameTab') + 4 * self.w(o)))
+        except Exception:
+            return '?'
+
+    # The runtime routines may change the temporaries, as in trap.handler.
+    def clobber(self):
+        for r in (2, 3, 8, 9, 10, 11, 12):
+            self.r[r] = 0x0badbad0
+
+    def runtime(self, name):
+        r = self.r
+        if name == 'Object.copy':
+            self.clobber()
+            r[5] = 0x0badbad0
+            r[4] = self.copy(r[4])
+        elif name == 'Object.abort':
+            self.out.append('Abort called from class %s\n' % self.classname(r[4]))
+            raise Exit()
+        elif name == 'Object.type_name':
+            o = r[4]
+            self.clobber()
+            r[4] = self.w(self.addr('class_nameTab') + 4 * self.w(o))
+        elif name == 'IO.out_string':
+            self.out.append(self.str_of(self.w(r[SP] + 4)))
+            r[SP] += 4
+            self.clobber()
+        elif name == 'IO.out_int':
+            self.out.append(str(self.int_of(self.w(r[SP] + 4))))
+            r[SP] += 4
+            self.clobber()
+        elif name == 'IO.in_string':
+            line = self.stdin.pop(0) if self.stdin else ''
+            self.clobber()
+            r[4] = self.new_str(line)
+        elif name == 'IO.in_int':
+            line = self.stdin.pop(0) if self.stdin else '0'
+            try:
+                v = int(line.strip())
+            except ValueError:
+                v = 0
+            self.clobber()
+            r[4] = self.new_int(v)
+        elif name == 'String.length':
+            o = r[4]
+            self.clobber()
+            r[4] = self.new_int(self.int_of(self.w(o + 12)))
+        elif name == 'String.concat':
+            o = r[4]
+            a = self.w(r[SP] + 4)
+            r[SP] += 4
+            self.clobber()
+            r[4] = self.new_str(self.str_of(o) + self.str_of(a))
+        elif name == 'String.substr':
+            o = r[4]
+            n = self.int_of(self.w(r[SP] + 4))
+            i = self.int_of(self.w(r[SP] + 8))
+            r[SP] += 8
+            s = self.str_of(o)
+            if i < 0 or n < 0 or i + n > len(s):
+                self.out.append('Index to substr is out of range\n')
+                raise Exit()
+            self.clobber()
+            r[4] = self.new_str(s[i:i + n])
+        elif name == 'equality_test':
+            a, b = r[9], r[10]
+            same = False
+            if a and b and self.w(a) == self.w(b):
+                t = self.w(a)
+                if t in (self.tag('_int_tag'), self.tag('_bool_tag')):
+                    same = self.int_of(a) == self.int_of(b)
+                elif t == self.tag('_string_tag'):
+                    same = self.str_of(a) == self.str_of(b)
+            if not same:
+                r[4] = r[5]
+        elif name == '_dispatch_abort':
+            self.out.append('%s:%d: Dispatch to void.\n' % (self.str_of(r[4]), r[9]))
+            raise Exit()
+        elif name == '_case_abort2':
+            self.out.append('%s:%d: Match on void in case statement.\n' % (self.str_of(r[4]), r[9]))
+            raise Exit()
+        elif name == '_case_abort':
+            self.out.append('No match in case statement for Class %s\n' % self.classname(r[4]))
+            raise Exit()
+        elif name == '_GenGC_Assign':
+            self.pending.discard(r[5])
+        elif name == '_gc_check':
+            pass
+        else:
+            raise Fault('runtime ' + name)
+
+    # The next instruction after a jump to a text address, running the
+    # routine there first if it is one of the runtime's.
+    def jump_addr(self, addr, pc, call):
+        if addr < TEXT:
+            raise Fault('jump to non-text %#x' % addr)
+        k = (addr - TEXT) // 4
+        if k >= len(self.code):
+            self.runtime(RUNTIME[k - len(self.code)])
+            if call:
+                return pc + 1
+            return 'RET' if self.r[RA] == RETMAGIC else (self.r[RA] - TEXT) // 4
+        if call:
+            self.r[RA] = TEXT + 4 * (pc + 1)
+        return k
+
+    def value(self, a):
+        return self.r[REGS[a]] if a.startswith('$') else int(a, 0)
+
+    def run_from(self, entry, limit):
+        r = self.r
+        code = self.code
+        gen = self.w(self.addr('_MemMgr_INITIALIZER')) == self.runtime_addr('_GenGC_Init')
+        mem_operands = {}
+        trace = []
+        pc = self.target(entry)
+        r[RA] = RETMAGIC
+        cnt = 0
+        try:
+            while pc != 'RET':
+                if pc >= len(code):
+                    raise Fault('fell off text')
+                trace.append(pc)
+                if len(trace) > 64:
+                    del trace[:32]
+                op, a, _ = code[pc]
+                cnt += 1
+                npc = pc + 1
+                if op == 'lw' or op == 'sw':
+                    c = mem_operands.get(pc)
+                    if c is None:
+                        m = re.match(r'^(-?\d+)\((\$\w+)\)$', a[1])
+                        c = (REGS[a[0]], (int(m.group(1)), REGS[m.group(2)]) if m else a[1])
+                        mem_operands[pc] = c
+                    rd, where = c
+                    addr = r[where[1]] + where[0] if isinstance(where, tuple) else self.addr(where)
+                    if op == 'lw':
+                        v = self.w(addr)
+                        if rd:
+                            r[rd] = v
+                    else:
+                        v = r[rd]
+                        self.sw(addr, v)
+                        if gen and self.heap_start <= addr < self.old and self.old <= v < r[GP]:
+                            self.pending.add(addr)
+                elif op == 'addiu' or op == 'addi':
+                    r[REGS[a[0]]] = s32(r[REGS[a[1]]] + int(a[2], 0))
+                elif op == 'move':
+                    r[REGS[a[0]]] = r[REGS[a[1]]]
+                elif op == 'li':
+                    r[REGS[a[0]]] = s32(int(a[1], 0))
+                elif op == 'la':
+                    r[REGS[a[0]]] = r[REGS[a[1]]] if a[1].startswith('$') else self.addr(a[1])
+                elif op in ('add', 'addu'):
+                    r[REGS[a[0]]] = s32(r[REGS[a[1]]] + self.value(a[2]))
+                elif op in ('sub', 'subu'):
+                    r[REGS[a[0]]] = s32(r[REGS[a[1]]] - self.value(a[2]))
+                elif op == 'mul':
+                    r[REGS[a[0]]] = s32(r[REGS[a[1]]] * self.value(a[2]))
+                elif op == 'div':
+                    d = self.value(a[2])
+                    if d == 0:
+                        raise Fault('division by zero')
+                    n = r[REGS[a[1]]]
+                    q = abs(n) // abs(d)
+                    r[REGS[a[0]]] = s32(-q if (n < 0) != (d < 0) else q)
+                elif op == 'neg':
+                    r[REGS[a[0]]] = s32(-r[REGS[a[1]]])
+                elif op == 'sll':
+                    r[REGS[a[0]]] = s32(r[REGS[a[1]]] << int(a[2], 0))
+                elif op == 'sra':
+                    r[REGS[a[0]]] = r[REGS[a[1]]] >> int(a[2], 0)
+                elif op in ('slt', 'slti'):
+                    r[REGS[a[0]]] = 1 if r[REGS[a[1]]] < self.value(a[2]) else 0
+                elif op == 'xori':
+                    r[REGS[a[0]]] = r[REGS[a[1]]] ^ int(a[2], 0)
+                elif op == 'seq':
+                    r[REGS[a[0]]] = 1 if r[REGS[a[1]]] == r[REGS[a[2]]] else 0
+                elif op in ('b', 'j'):
+                    npc = self.target(a[0])
+                    if isinstance(npc, tuple):
+                        self.runtime(npc[1])
+                        npc = 'RET' if r[RA] == RETMAGIC else (r[RA] - TEXT) // 4
+                elif op in ('beq', 'bne', 'blt', 'ble', 'bgt', 'bge'):
+                    x = r[REGS[a[0]]]
+                    y = self.value(a[1])
+                    taken = {'beq': x == y, 'bne': x != y, 'blt': x < y,
+                             'ble': x <= y, 'bgt': x > y, 'bge': x >= y}[op]
+                    if taken:
+                        npc = self.target(a[2])
+                elif op in ('beqz', 'bnez', 'bltz', 'bgez', 'blez', 'bgtz'):
+                    x = r[REGS[a[0]]]
+                    taken = {'beqz': x == 0, 'bnez': x != 0, 'bltz': x < 0,
+                             'bgez': x >= 0, 'blez': x <= 0, 'bgtz': x > 0}[op]
+                    if taken:
+                        npc = self.target(a[1])
+                elif op == 'jal':
+                    t = self.target(a[0])
+                    if isinstance(t, tuple):
+                        self.runtime(t[1])
+                    else:
+                        r[RA] = TEXT + 4 * (pc + 1)
+                        npc = t
+                elif op == 'jalr':
+                    npc = self.jump_addr(r[REGS[a[0]]], pc, call=True)
+                elif op == 'jr':
+                    addr = r[REGS[a[0]]]
+                    npc = 'RET' if addr == RETMAGIC else self.jump_addr(addr, pc, call=False)
+                elif op == 'nop':
+                    pass
+                else:
+                    raise Fault('unknown op %s' % op)
+                r[0] = 0
+                pc = npc
+                if cnt > limit:
+                    raise Fault('instruction limit')
+        except Fault as f:
+            where = code[pc][2].strip() if isinstance(pc, int) and pc < len(code) else pc
+            raise Fault('%s at pc %s: %s | prev %s' %
+                        (f, pc, where, [code[x][2].strip() for x in trace[-6:]]))
+        finally:
+            self.count += cnt
+
+    # Starts the program the way trap.handler does: a copy of Main_protObj
+    # goes through Main_init and then Main.main.
+    def run(self, limit=200000000):
+        r = self.r
+        r[SP] = STACKTOP
+        r[4] = self.copy(self.addr('Main_protObj'))
+        r[SP] -= 4
+        self.sw(r[SP] + 4, r[4])
+        r[16] = r[4]
+        try:
+            for entry in ('Main_init', 'Main.main'):
+                self.run_from(entry, limit)
+            self.out.append('\nCOOL program successfully executed\n')
+        except Exit:
+            pass
+        return ''.join(self.out)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write('usage: mipsim.py file.s < input\n')
+        sys.exit(2)
+    vm = VM(open(sys.argv[1]).read(), '' if sys.stdin.isatty() else sys.stdin.read())
+    status = 0
+    try:
+        sys.stdout.write(vm.run())
+    except Fault as f:
+        sys.stdout.write(''.join(vm.out))
+        sys.stdout.write('\n*** FAULT: %s\n' % f)
+        status = 1
+    sys.stderr.write('instructions: %d allocs: %d\n' % (vm.count, vm.allocs))
+    sys.exit(status)
+
+
+if __name__ == '__main__':
+    main()
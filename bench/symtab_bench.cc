@@ -0,0 +1,83 @@
+//
+// symtab_bench.cc
+//
+// Microbenchmark of the scoped symbol tables on deep let nesting:
+// SymbolTable from the course symtab.h against ScopedSymbolTable from
+// common/scoped-symtab.h.
+//
+//     g++ -O2 -I/usr/class/cs143/cool/include/PA4 -o symtab_bench symtab_bench.cc
+//     ./symtab_bench [maxdepth] [attributes]
+//
+// Every round models a method body nested `depth' lets deep inside a
+// class with `attributes' attributes, the shape semant and cgen walk:
+// one scope holds the attributes, then each let enters a scope, binds
+// its variable and looks up the innermost let variable, one outer let
+// variable and one attribute, and all scopes are left on the way out.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <vector>
+#include "symtab.h"
+#include "../common/scoped-symtab.h"
+
+typedef int *Sym;
+
+static double now_ns()
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1e9 + tv.tv_usec * 1e3;
+}
+
+// Returns the time of one round in ns.  The lookups are summed into
+// sink so they cannot be optimized away.
+template <class Table>
+static double round_ns(std::vector<int>& syms, int attrs, int depth, int rounds, long& sink)
+{
+	double start = now_ns();
+
+	for (int r = 0; r < rounds; r++){
+		Table t;
+		t.enterscope();
+		for (int a = 0; a < attrs; a++)
+			t.addid(&syms[a], &syms[a]);
+
+		for (int d = 0; d < depth; d++){
+			t.enterscope();
+			t.addid(&syms[attrs + d], &syms[attrs + d]);
+			sink += *t.lookup(&syms[attrs + d]);
+			sink += *t.lookup(&syms[attrs + d / 2]);
+			sink += *t.lookup(&syms[d % attrs]);
+		}
+		for (int d = 0; d < depth; d++)
+			t.exitscope();
+		t.exitscope();
+	}
+	return (now_ns() - start) / rounds;
+}
+
+int main(int argc, char **argv)
+{
+	int maxdepth = argc > 1 ? atoi(argv[1]) : 4096;
+	int attrs = argc > 2 ? atoi(argv[2]) : 64;
+	if (maxdepth < 1 || attrs < 1){
+		fprintf(stderr, "usage: %s [maxdepth] [attributes]\n", argv[0]);
+		return 1;
+	}
+
+	std::vector<int> syms(attrs + maxdepth);
+	for (size_t i = 0; i < syms.size(); i++) syms[i] = i;
+	long sink = 0;
+
+	printf("%8s %16s %16s %8s\n", "depth", "SymbolTable ns", "Scoped ns", "speedup");
+	for (int depth = 16; depth <= maxdepth; depth *= 2){
+		// Keep the work per measurement roughly constant.
+		int rounds = 1 + (1 << 22) / ((long) depth * depth + attrs);
+		double list = round_ns<SymbolTable<Sym, int> >(syms, attrs, depth, rounds, sink);
+		double hashed = round_ns<ScopedSymbolTable<Sym, int> >(syms, attrs, depth, rounds, sink);
+		printf("%8d %16.0f %16.0f %8.1f\n", depth, list, hashed, list / hashed);
+	}
+	return sink == 42;
+}
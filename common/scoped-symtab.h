@@ -0,0 +1,97 @@
+//
+// scoped-symtab.h
+//
+// A hashed replacement for the SymbolTable of symtab.h with the same
+// interface (enterscope, exitscope, addid, lookup, probe, dump).
+//
+// SymbolTable keeps a list of scopes, each a list of entries, so lookup
+// walks every binding in scope.  Here every symbol owns a stack of its
+// bindings, innermost last, and lookup is one hash probe.  An undo log
+// records the symbols bound in each scope in order; exitscope pops the
+// log back to the scope mark and pops the stack of each symbol on it,
+// so entering a scope is O(1) and leaving it costs one step per binding
+// it made.
+//
+// Unlike SymbolTable the scopes are not shared between copies, so a
+// table should be passed by reference.
+//
+
+#ifndef SCOPED_SYMTAB_H
+#define SCOPED_SYMTAB_H
+
+#include <stdlib.h>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+template <class SYM, class DAT>
+class ScopedSymbolTable
+{
+	struct Binding
+	{
+		DAT *info;
+		int scope;
+	};
+
+	std::unordered_map<SYM, std::vector<Binding> > bindings;
+	std::vector<SYM> log;          // symbols in the order they were bound
+	std::vector<size_t> marks;     // log size at each enterscope
+
+public:
+	void enterscope()
+	{
+		marks.push_back(log.size());
+	}
+
+	void exitscope()
+	{
+		if (marks.empty()) abort();
+		size_t mark = marks.back();
+		marks.pop_back();
+		while (log.size() > mark){
+			bindings[log.back()].pop_back();
+			log.pop_back();
+		}
+	}
+
+	DAT *addid(SYM s, DAT *i)
+	{
+		if (marks.empty()) abort();
+		Binding b = { i, (int) marks.size() };
+		bindings[s].push_back(b);
+		log.push_back(s);
+		return i;
+	}
+
+	// Innermost binding of s, NULL if s is not bound.
+	DAT *lookup(SYM s) const
+	{
+		auto it = bindings.find(s);
+		if (it == bindings.end() || it->second.empty()) return NULL;
+		return it->second.back().info;
+	}
+
+	// Binding of s made in the current scope, NULL if there is none.
+	DAT *probe(SYM s) const
+	{
+		if (marks.empty()) abort();
+		auto it = bindings.find(s);
+		if (it == bindings.end() || it->second.empty()) return NULL;
+		Binding const& b = it->second.back();
+		return b.scope == (int) marks.size() ? b.info : NULL;
+	}
+
+	int depth() const { return marks.size(); }
+
+	void dump() const
+	{
+		for (size_t s = 0; s < marks.size(); s++){
+			size_t end = s + 1 < marks.size() ? marks[s + 1] : log.size();
+			std::cerr << "Scope " << s + 1 << ":" << std::endl;
+			for (size_t i = marks[s]; i < end; i++)
+				std::cerr << "  " << log[i] << std::endl;
+		}
+	}
+};
+
+#endif
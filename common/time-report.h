@@ -0,0 +1,229 @@
+//
+// time-report.h
+//
+// -ftime-report style instrumentation of the compiler phases.
+//
+// The phases run as separate processes started by mycoolc and their
+// flags are parsed by the course supplied handle_flags.cc, so the
+// report is switched on through the environment instead of a flag:
+//
+//      COOL_TIME_REPORT=report.json ./mycoolc foo.cl
+//
+// Every phase process prints a table of its timed steps on stderr when
+// it exits, and appends the same data as one JSON object per line to
+// the file named by COOL_TIME_REPORT ("-" sends the JSON to stderr as
+// well).  With the variable unset a PhaseTimer is a single pointer
+// test and nothing is recorded.
+//
+// For every step we record wall time, CPU time and the peak resident
+// set size at the end of the step.  Built with -DTIME_REPORT_ALLOCS the
+// number of operator new calls made during the step is counted too; that
+// replaces the global operator new, so it is left out of normal builds.
+//
+// The header is shared by all the phases and included as
+// "../common/time-report.h", since the course Makefiles fix the include
+// path.  The including file names its phase in TIME_REPORT_PROCESS.
+// The header must be included by exactly one translation unit of a
+// program.
+//
+
+#ifndef TIME_REPORT_H
+#define TIME_REPORT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifndef TIME_REPORT_PROCESS
+#error "time-report.h: define TIME_REPORT_PROCESS to the name of the phase"
+#endif
+
+static unsigned long time_report_allocs = 0;
+
+#ifdef TIME_REPORT_ALLOCS
+// Kept out of line so that g++ pairs every delete expression with this
+// operator delete rather than with the free() it would inline to.
+__attribute__((noinline)) void *operator new(size_t n)
+{
+	time_report_allocs++;
+	void *p = malloc(n ? n : 1);
+	if (p == NULL) throw std::bad_alloc();
+	return p;
+}
+
+__attribute__((noinline)) void operator delete(void *p) noexcept
+{
+	free(p);
+}
+#endif
+
+class TimeReport
+{
+	struct Record
+	{
+		std::string name;
+		int depth;
+		double wall, cpu;
+		long peak_rss_kb;
+		unsigned long allocs;
+	};
+
+	std::vector<Record> records;
+	std::vector<size_t> running;    // indices of the steps not yet ended
+	const char *path;
+
+	TimeReport(const char *p): path(p) {}
+
+	static double wall_ms()
+	{
+		struct timeval tv;
+		gettimeofday(&tv, NULL);
+		return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+	}
+
+	static double cpu_ms()
+	{
+		return clock() * 1000.0 / CLOCKS_PER_SEC;
+	}
+
+	static long peak_rss_kb()
+	{
+		struct rusage ru;
+		getrusage(RUSAGE_SELF, &ru);
+		return ru.ru_maxrss;
+	}
+
+	static void write_at_exit()
+	{
+		get()->write();
+	}
+
+	// Writes s as a JSON string.  Step names hold class and method
+	// names, but may hold anything a phase passes as a detail.
+	static void write_json_string(FILE *f, std::string const& s)
+	{
+		putc('"', f);
+		for (unsigned char c : s){
+			if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+			else if (c < 0x20) fprintf(f, "\\u%04x", c);
+			else putc(c, f);
+		}
+		putc('"', f);
+	}
+
+public:
+	// NULL unless COOL_TIME_REPORT is set.
+	static TimeReport *get()
+	{
+		static TimeReport *report = NULL;
+		static bool checked = false;
+
+		if (!checked){
+			checked = true;
+			const char *p = getenv("COOL_TIME_REPORT");
+			if (p != NULL){
+				report = new TimeReport(p);
+				atexit(write_at_exit);
+			}
+		}
+		return report;
+	}
+
+	void begin(const char *name, const char *detail)
+	{
+		Record r;
+		r.name = name;
+		if (detail != NULL){
+			r.name += " ";
+			r.name += detail;
+		}
+		r.depth = running.size();
+		r.wall = wall_ms();
+		r.cpu = cpu_ms();
+		r.peak_rss_kb = 0;
+		r.allocs = time_report_allocs;
+		running.push_back(records.size());
+		records.push_back(r);
+	}
+
+	void end()
+	{
+		Record& r = records[running.back()];
+		running.pop_back();
+		r.wall = wall_ms() - r.wall;
+		r.cpu = cpu_ms() - r.cpu;
+		r.peak_rss_kb = peak_rss_kb();
+		r.allocs = time_report_allocs - r.allocs;
+	}
+
+	void write()
+	{
+		// Steps still running at exit (e.g. the lexer) end here.
+		while (!running.empty()) end();
+
+		const char *process = TIME_REPORT_PROCESS;
+#ifdef TIME_REPORT_ALLOCS
+		const bool counted = true;
+#else
+		const bool counted = false;
+#endif
+
+		fprintf(stderr, "\n%-40s %10s %10s %12s %10s\n",
+				process, "wall ms", "cpu ms", "peak RSS kB", "allocs");
+		for (auto const& r : records){
+			fprintf(stderr, "%*s%-*s %10.2f %10.2f %12ld ",
+					2 * r.depth, "", 40 - 2 * r.depth, r.name.c_str(),
+					r.wall, r.cpu, r.peak_rss_kb);
+			if (counted) fprintf(stderr, "%10lu\n", r.allocs);
+			else fprintf(stderr, "%10s\n", "-");
+		}
+
+		FILE *json = strcmp(path, "-") == 0 ? stderr : fopen(path, "a");
+		if (json == NULL){
+			fprintf(stderr, "time report: cannot open %s\n", path);
+			return;
+		}
+		fprintf(json, "{\"process\": ");
+		write_json_string(json, process);
+		fprintf(json, ", \"phases\": [");
+		for (size_t i = 0; i < records.size(); i++){
+			Record const& r = records[i];
+			fprintf(json, "%s{\"name\": ", i ? ", " : "");
+			write_json_string(json, r.name);
+			fprintf(json, ", \"depth\": %d, \"wall_ms\": %.3f, \"cpu_ms\": %.3f, "
+					"\"peak_rss_kb\": %ld, \"allocs\": ", r.depth, r.wall, r.cpu,
+					r.peak_rss_kb);
+			if (counted) fprintf(json, "%lu}", r.allocs);
+			else fprintf(json, "null}");
+		}
+		fprintf(json, "]}\n");
+		if (json != stderr) fclose(json);
+	}
+};
+
+//
+// Times the enclosing scope as one step of the report.
+//
+class PhaseTimer
+{
+	TimeReport *report;
+
+public:
+	PhaseTimer(const char *name, const char *detail = NULL): report(TimeReport::get())
+	{
+		if (report) report->begin(name, detail);
+	}
+
+	~PhaseTimer()
+	{
+		if (report) report->end();
+	}
+};
+
+#endif
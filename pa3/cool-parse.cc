@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -65,18 +70,19 @@
 #define yyerror         cool_yyerror
 #define yydebug         cool_yydebug
 #define yynerrs         cool_yynerrs
-
 #define yylval          cool_yylval
 #define yychar          cool_yychar
 #define yylloc          cool_yylloc
 
-/* Copy the first part of user declarations.  */
-#line 6 "cool.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 6 "cool.y"
 
   #include <iostream>
   #include "cool-tree.h"
   #include "stringtab.h"
   #include "utilities.h"
+  #define TIME_REPORT_PROCESS "parser"
+  #include "../common/time-report.h"
   
   extern char *curr_filename;
   
@@ -154,179 +160,184 @@
     int omerrs = 0;               /* number of errors in lexing and parsing */
     
 
-#line 158 "cool.tab.c" /* yacc.c:339  */
+#line 164 "cool.tab.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "cool.tab.h".  */
-#ifndef YY_COOL_YY_COOL_TAB_H_INCLUDED
-# define YY_COOL_YY_COOL_TAB_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
-#if YYDEBUG
-extern int cool_yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    CLASS = 258,
-    ELSE = 259,
-    FI = 260,
-    IF = 261,
-    IN = 262,
-    INHERITS = 263,
-    LET = 264,
-    LOOP = 265,
-    POOL = 266,
-    THEN = 267,
-    WHILE = 268,
-    CASE = 269,
-    ESAC = 270,
-    OF = 271,
-    DARROW = 272,
-    NEW = 273,
-    ISVOID = 274,
-    STR_CONST = 275,
-    INT_CONST = 276,
-    BOOL_CONST = 277,
-    TYPEID = 278,
-    OBJECTID = 279,
-    ASSIGN = 280,
-    NOT = 281,
-    LE = 282,
-    ERROR = 283
-  };
-#endif
-/* Tokens.  */
-#define CLASS 258
-#define ELSE 259
-#define FI 260
-#define IF 261
-#define IN 262
-#define INHERITS 263
-#define LET 264
-#define LOOP 265
-#define POOL 266
-#define THEN 267
-#define WHILE 268
-#define CASE 269
-#define ESAC 270
-#define OF 271
-#define DARROW 272
-#define NEW 273
-#define ISVOID 274
-#define STR_CONST 275
-#define INT_CONST 276
-#define BOOL_CONST 277
-#define TYPEID 278
-#define OBJECTID 279
-#define ASSIGN 280
-#define NOT 281
-#define LE 282
-#define ERROR 283
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "cool.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 89 "cool.y" /* yacc.c:355  */
-
-      Boolean boolean;
-      Symbol symbol;
-      Program program;
-      Class_ class_;
-      Classes classes;
-      Feature feature;
-      Features features;
-      Formal formal;
-      Formals formals;
-      Case case_;
-      Cases cases;
-      Expression expression;
-      Expressions expressions;
-      char *error_msg;
-    
-
-#line 272 "cool.tab.c" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_CLASS = 3,                      /* CLASS  */
+  YYSYMBOL_ELSE = 4,                       /* ELSE  */
+  YYSYMBOL_FI = 5,                         /* FI  */
+  YYSYMBOL_IF = 6,                         /* IF  */
+  YYSYMBOL_IN = 7,                         /* IN  */
+  YYSYMBOL_INHERITS = 8,                   /* INHERITS  */
+  YYSYMBOL_LET = 9,                        /* LET  */
+  YYSYMBOL_LOOP = 10,                      /* LOOP  */
+  YYSYMBOL_POOL = 11,                      /* POOL  */
+  YYSYMBOL_THEN = 12,                      /* THEN  */
+  YYSYMBOL_WHILE = 13,                     /* WHILE  */
+  YYSYMBOL_CASE = 14,                      /* CASE  */
+  YYSYMBOL_ESAC = 15,                      /* ESAC  */
+  YYSYMBOL_OF = 16,                        /* OF  */
+  YYSYMBOL_DARROW = 17,                    /* DARROW  */
+  YYSYMBOL_NEW = 18,                       /* NEW  */
+  YYSYMBOL_ISVOID = 19,                    /* ISVOID  */
+  YYSYMBOL_STR_CONST = 20,                 /* STR_CONST  */
+  YYSYMBOL_INT_CONST = 21,                 /* INT_CONST  */
+  YYSYMBOL_BOOL_CONST = 22,                /* BOOL_CONST  */
+  YYSYMBOL_TYPEID = 23,                    /* TYPEID  */
+  YYSYMBOL_OBJECTID = 24,                  /* OBJECTID  */
+  YYSYMBOL_ASSIGN = 25,                    /* ASSIGN  */
+  YYSYMBOL_NOT = 26,                       /* NOT  */
+  YYSYMBOL_LE = 27,                        /* LE  */
+  YYSYMBOL_ERROR = 28,                     /* ERROR  */
+  YYSYMBOL_29_ = 29,                       /* '<'  */
+  YYSYMBOL_30_ = 30,                       /* '='  */
+  YYSYMBOL_31_ = 31,                       /* '+'  */
+  YYSYMBOL_32_ = 32,                       /* '-'  */
+  YYSYMBOL_33_ = 33,                       /* '*'  */
+  YYSYMBOL_34_ = 34,                       /* '/'  */
+  YYSYMBOL_35_ = 35,                       /* '~'  */
+  YYSYMBOL_36_ = 36,                       /* '@'  */
+  YYSYMBOL_37_ = 37,                       /* '.'  */
+  YYSYMBOL_38_ = 38,                       /* '{'  */
+  YYSYMBOL_39_ = 39,                       /* '}'  */
+  YYSYMBOL_40_ = 40,                       /* ';'  */
+  YYSYMBOL_41_ = 41,                       /* ','  */
+  YYSYMBOL_42_ = 42,                       /* '('  */
+  YYSYMBOL_43_ = 43,                       /* ')'  */
+  YYSYMBOL_44_ = 44,                       /* ':'  */
+  YYSYMBOL_YYACCEPT = 45,                  /* $accept  */
+  YYSYMBOL_program = 46,                   /* program  */
+  YYSYMBOL_class_list = 47,                /* class_list  */
+  YYSYMBOL_class = 48,                     /* class  */
+  YYSYMBOL_feature_list = 49,              /* feature_list  */
+  YYSYMBOL_feature = 50,                   /* feature  */
+  YYSYMBOL_expression = 51,                /* expression  */
+  YYSYMBOL_let_expression = 52,            /* let_expression  */
+  YYSYMBOL_case_list = 53,                 /* case_list  */
+  YYSYMBOL_case = 54,                      /* case  */
+  YYSYMBOL_formal_list = 55,               /* formal_list  */
+  YYSYMBOL_formal = 56,                    /* formal  */
+  YYSYMBOL_expression_list_colon = 57,     /* expression_list_colon  */
+  YYSYMBOL_expression_list_comma = 58      /* expression_list_comma  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
-/* Location type.  */
-#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE YYLTYPE;
-struct YYLTYPE
-{
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
-};
-# define YYLTYPE_IS_DECLARED 1
-# define YYLTYPE_IS_TRIVIAL 1
-#endif
 
 
-extern YYSTYPE cool_yylval;
-extern YYLTYPE cool_yylloc;
-int cool_yyparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_COOL_YY_COOL_TAB_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 303 "cool.tab.c" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -334,15 +345,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -356,47 +380,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -409,8 +429,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -475,8 +509,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -486,18 +519,19 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
   YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -510,11 +544,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -526,12 +560,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -543,7 +577,7 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  9
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   386
+#define YYLAST   406
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  45
@@ -554,17 +588,20 @@ union yyalloc
 /* YYNSTATES -- Number of states.  */
 #define YYNSTATES  169
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   284
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint8 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -598,86 +635,86 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   167,   167,   171,   173,   175,   180,   183,   185,   187,
-     194,   195,   197,   199,   204,   206,   208,   210,   215,   217,
-     219,   221,   223,   225,   227,   229,   231,   233,   235,   237,
-     239,   241,   243,   245,   247,   249,   251,   253,   255,   257,
-     259,   261,   263,   265,   270,   272,   274,   276,   278,   280,
-     285,   287,   289,   294,   296,   302,   303,   305,   307,   312,
-     314,   318,   320,   322,   327,   329,   332,   333
+       0,   174,   174,   179,   181,   183,   188,   191,   193,   195,
+     202,   203,   205,   207,   212,   214,   216,   218,   223,   225,
+     227,   229,   231,   233,   235,   237,   239,   241,   243,   245,
+     247,   249,   251,   253,   255,   257,   259,   261,   263,   265,
+     267,   269,   271,   273,   278,   280,   282,   284,   286,   288,
+     293,   295,   297,   302,   304,   310,   311,   313,   315,   320,
+     322,   326,   328,   330,   335,   337,   340,   341
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "CLASS", "ELSE", "FI", "IF", "IN",
-  "INHERITS", "LET", "LOOP", "POOL", "THEN", "WHILE", "CASE", "ESAC", "OF",
-  "DARROW", "NEW", "ISVOID", "STR_CONST", "INT_CONST", "BOOL_CONST",
-  "TYPEID", "OBJECTID", "ASSIGN", "NOT", "LE", "ERROR", "'<'", "'='",
-  "'+'", "'-'", "'*'", "'/'", "'~'", "'@'", "'.'", "'{'", "'}'", "';'",
-  "','", "'('", "')'", "':'", "$accept", "program", "class_list", "class",
-  "feature_list", "feature", "expression", "let_expression", "case_list",
-  "case", "formal_list", "formal", "expression_list_colon",
-  "expression_list_comma", YY_NULLPTR
+  "\"end of file\"", "error", "\"invalid token\"", "CLASS", "ELSE", "FI",
+  "IF", "IN", "INHERITS", "LET", "LOOP", "POOL", "THEN", "WHILE", "CASE",
+  "ESAC", "OF", "DARROW", "NEW", "ISVOID", "STR_CONST", "INT_CONST",
+  "BOOL_CONST", "TYPEID", "OBJECTID", "ASSIGN", "NOT", "LE", "ERROR",
+  "'<'", "'='", "'+'", "'-'", "'*'", "'/'", "'~'", "'@'", "'.'", "'{'",
+  "'}'", "';'", "','", "'('", "')'", "':'", "$accept", "program",
+  "class_list", "class", "feature_list", "feature", "expression",
+  "let_expression", "case_list", "case", "formal_list", "formal",
+  "expression_list_colon", "expression_list_comma", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   284,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,    60,
-      61,    43,    45,    42,    47,   126,    64,    46,   123,   125,
-      59,    44,    40,    41,    58
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -91
+#define YYPACT_NINF (-125)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-91)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -67
+#define YYTABLE_NINF (-67)
 
-#define yytable_value_is_error(Yytable_value) \
-  (!!((Yytable_value) == (-67)))
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     117,    24,   -15,    11,   174,   -91,     2,   197,    -7,   -91,
-     -19,   -91,    18,    89,    36,   -91,    50,     2,     2,     8,
-      59,   -91,    61,   -91,    73,    37,    66,    63,    91,   110,
-     -91,   -11,   -91,     2,    84,     8,   135,     4,    96,   170,
-     -91,    71,   -91,   104,   -91,   -91,   -91,   136,   -91,   170,
-       6,   170,   170,   137,   170,   -91,   -91,   -91,    14,   170,
-     170,   170,   170,   281,   146,   149,   247,    -5,   151,   -91,
-     224,   257,   -91,   118,   170,    65,   340,   118,   293,   108,
-     266,   143,   170,   170,   170,   170,   170,   176,   177,   -91,
-     -91,   170,   170,   170,     6,   179,   170,    80,   340,   163,
-     340,   125,   -91,   -91,   205,   305,   -91,   170,   349,   349,
-     105,   105,   118,   118,   172,   165,   329,   199,   340,   -91,
-       9,   235,    98,   187,   101,   -91,    65,   170,   -91,   -91,
-     -91,   349,   190,    65,   181,   170,   170,   170,     6,   -91,
-     122,   166,   -91,   -91,   -91,   183,   340,   184,   129,   -91,
-     208,   340,   186,   -91,   202,    65,   -91,   -91,   170,     6,
-     226,   139,   340,   -91,   170,   -91,   317,   232,   -91
+      80,     1,   -18,    30,   167,  -125,    13,   194,    24,  -125,
+     -22,  -125,    -5,    69,    26,  -125,    19,    13,    13,    16,
+      41,  -125,   -16,  -125,    35,    27,    32,    33,    49,    91,
+    -125,   -14,  -125,    13,    62,    16,    89,    67,    92,   163,
+    -125,    37,  -125,    79,  -125,  -125,  -125,   101,  -125,   163,
+      76,   163,   163,   120,   163,  -125,  -125,  -125,   -17,   163,
+     163,   190,   163,   301,   106,   142,   267,    22,   144,  -125,
+     244,   277,  -125,   116,   163,    66,   360,   116,   146,   313,
+     109,   286,   136,   163,   163,   163,   163,   163,   177,   166,
+    -125,  -125,   163,   163,   163,    76,   179,   163,    81,   360,
+     165,   360,   118,  -125,  -125,  -125,   325,  -125,   163,   369,
+     369,   184,   184,   116,   116,   170,   173,   349,   219,   360,
+    -125,    53,   255,   102,   195,   125,  -125,    66,   163,  -125,
+    -125,   369,   198,    66,   186,   163,   163,   163,    76,  -125,
+     178,   180,  -125,  -125,  -125,   188,   360,   185,   122,  -125,
+     228,   360,   206,  -125,   207,    66,  -125,  -125,   163,    76,
+     214,   132,   360,  -125,   163,  -125,   337,   226,  -125
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint8 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
 {
        0,     0,     0,     0,     0,     3,     0,     0,     0,     1,
        9,     4,    17,     0,     0,    11,     0,     0,     0,     0,
@@ -686,106 +723,110 @@ static const yytype_uint8 yydefact[] =
       16,     0,     6,    58,    59,    60,    57,     0,    43,     0,
        0,     0,     0,     0,     0,    36,    37,    38,    35,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,    39,
-       0,     0,    23,    24,     0,     0,    34,    32,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    15,
-       7,     0,     0,     0,     0,     0,     0,     0,    18,    43,
-      64,     0,    61,    20,     0,     0,    33,     0,    29,    31,
-      25,    26,    27,    28,     0,     0,     0,     0,    48,    49,
-       0,     0,     0,     0,     0,    50,     0,     0,    41,    63,
+       0,     0,    23,    24,     0,     0,    34,    32,    43,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      15,     7,     0,     0,     0,     0,     0,     0,     0,    18,
+      43,    64,     0,    63,    61,    20,     0,    33,     0,    29,
+      31,    25,    26,    27,    28,     0,     0,     0,     0,    48,
+      49,     0,     0,     0,     0,     0,    50,     0,     0,    41,
       62,    30,     0,     0,     0,     0,     0,     0,     0,    21,
        0,     0,    54,    22,    51,    67,    65,     0,     0,    14,
        0,    44,     0,    46,     0,     0,    40,    19,     0,     0,
        0,     0,    45,    47,     0,    42,     0,     0,    53
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-     -91,   -91,   248,    51,    47,    -8,   -39,   -90,   126,   -47,
-     215,   214,   -91,   -63
+    -125,  -125,   233,   134,    88,    -7,   -39,   -89,   121,   -26,
+     210,   209,  -125,  -124
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-      -1,     3,     4,     5,    14,    15,   100,    69,   124,   125,
-      29,    30,    79,   101
+       0,     3,     4,     5,    14,    15,   101,    69,   125,   126,
+      29,    30,    80,   102
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      63,    16,    93,    12,   119,    45,    23,    67,     8,    27,
-      66,     9,    70,    71,    39,    73,   136,    23,    23,     6,
-      76,    77,    78,    80,    -9,     1,    13,     2,    28,    40,
-      68,    17,    28,    23,   137,    98,    94,    21,    21,    74,
-     105,   -10,   108,   109,   110,   111,   112,   113,   153,   -55,
-     138,   -55,   116,   117,   118,    11,    75,   121,    11,    18,
-      13,    13,     6,   145,    25,    26,    99,    21,   131,   163,
-     148,    49,    21,    24,    50,    22,    34,   144,    51,    52,
-      41,   122,    31,    53,    54,    55,    56,    57,   146,    58,
-      13,    59,   161,   144,   123,    13,   150,   151,   152,   122,
-      60,    32,   142,    61,    35,   -13,   -66,    62,   -66,    48,
-      64,    33,   123,   -54,    49,   123,   143,    50,     1,   162,
-       2,    51,    52,   142,    42,   166,    53,    54,    55,    56,
-      57,    19,    58,    20,    59,    36,   123,   -52,    85,    86,
-      47,    87,    88,    60,    48,    37,    61,   103,   104,    49,
-      62,    37,    50,    38,    87,    88,    51,    52,    44,    65,
-      72,    53,    54,    55,    56,    57,   127,    58,   128,    59,
-     127,    48,   156,   107,    -2,    10,    49,     2,    60,    50,
-     127,    61,   165,    51,    52,    62,    90,    91,    53,    54,
-      55,    56,    57,   158,    58,    95,    59,    -5,    10,   114,
-       2,   115,   120,   135,   126,    60,   129,   133,    61,   132,
-     154,   141,    62,   157,   147,    81,    82,    83,    84,    85,
-      86,   149,    87,    88,   127,   160,   155,   159,    81,    82,
-      83,    84,    85,    86,    96,    87,    88,    81,    82,    83,
-      84,    85,    86,   164,    87,    88,   139,   168,   140,     7,
-      43,    46,     0,    81,    82,    83,    84,    85,    86,    92,
-      87,    88,     0,     0,    81,    82,    83,    84,    85,    86,
-       0,    87,    88,    97,     0,     0,    81,    82,    83,    84,
-      85,    86,     0,    87,    88,     0,    81,    82,    83,    84,
-      85,    86,     0,    87,    88,    81,    82,    83,    84,    85,
-      86,     0,    87,    88,     0,     0,     0,     0,     0,   106,
-      81,    82,    83,    84,    85,    86,     0,    87,    88,     0,
-       0,    89,    81,    82,    83,    84,    85,    86,     0,    87,
-      88,     0,     0,   102,    81,    82,    83,    84,    85,    86,
-       0,    87,    88,     0,     0,   130,    81,    82,    83,    84,
-      85,    86,     0,    87,    88,     0,     0,   167,    81,    82,
-      83,    84,    85,    86,     0,    87,    88,     0,   134,    81,
-      82,    83,    84,    85,    86,     0,    87,    88,   -67,   -67,
-      83,    84,    85,    86,     0,    87,    88
+      63,    -9,     1,   145,     2,     8,   120,    23,    74,   148,
+      66,    39,    70,    71,    12,    73,     6,    27,    23,    23,
+      76,    77,    79,    81,    32,    75,    40,    21,    21,    94,
+       9,   161,    16,    21,    23,    99,    18,    13,    21,     6,
+      28,   106,    24,   109,   110,   111,   112,   113,   114,   153,
+      13,    13,   -10,   117,   118,   119,    13,   -55,   122,   -55,
+     136,    13,    17,    95,    31,    22,    34,   100,    45,   131,
+     163,   -13,    49,    33,    35,    50,    64,    67,   137,    51,
+      52,     1,   123,     2,    53,    54,    55,    56,    57,   146,
+      58,    28,    59,    36,   138,   124,   150,   151,   152,   144,
+      68,    60,    42,   123,    61,    25,    26,   -66,    62,   -66,
+      48,    19,    44,    20,   144,    49,   124,   -54,    50,   162,
+      37,    41,    51,    52,    65,   166,   142,    53,    54,    55,
+      56,    57,    37,    58,    38,    59,    47,    48,    11,   124,
+     143,    11,    49,    72,    60,    50,    91,    61,   105,    51,
+      52,    62,    88,    89,    53,    54,    55,    56,    57,   128,
+      58,   129,    59,   128,    48,   156,   108,    -2,    10,    49,
+       2,    60,    50,   128,    61,   165,    51,    52,    62,   142,
+      92,    53,    54,    55,    56,    57,   103,    58,    96,    59,
+     116,    78,   124,   -52,    -5,    10,    49,     2,    60,    50,
+     115,    61,   121,    51,    52,    62,   127,   132,    53,    54,
+      55,    56,    57,   158,    58,   133,    59,    86,    87,   141,
+      88,    89,   147,   135,   154,    60,   149,   155,    61,   128,
+     160,   164,    62,   157,     7,    82,    83,    84,    85,    86,
+      87,   168,    88,    89,   140,    43,    46,   159,    82,    83,
+      84,    85,    86,    87,    97,    88,    89,    82,    83,    84,
+      85,    86,    87,     0,    88,    89,   139,     0,     0,     0,
+       0,     0,     0,    82,    83,    84,    85,    86,    87,    93,
+      88,    89,     0,     0,    82,    83,    84,    85,    86,    87,
+       0,    88,    89,    98,     0,     0,    82,    83,    84,    85,
+      86,    87,     0,    88,    89,     0,    82,    83,    84,    85,
+      86,    87,     0,    88,    89,    82,    83,    84,    85,    86,
+      87,     0,    88,    89,     0,     0,     0,     0,     0,   107,
+      82,    83,    84,    85,    86,    87,     0,    88,    89,     0,
+       0,    90,    82,    83,    84,    85,    86,    87,     0,    88,
+      89,     0,     0,   104,    82,    83,    84,    85,    86,    87,
+       0,    88,    89,     0,     0,   130,    82,    83,    84,    85,
+      86,    87,     0,    88,    89,     0,     0,   167,    82,    83,
+      84,    85,    86,    87,     0,    88,    89,     0,   134,    82,
+      83,    84,    85,    86,    87,     0,    88,    89,   -67,   -67,
+      84,    85,    86,    87,     0,    88,    89
 };
 
 static const yytype_int16 yycheck[] =
 {
-      39,     8,     7,     1,    94,     1,    14,     1,    23,     1,
-      49,     0,    51,    52,    25,    54,     7,    25,    26,    38,
-      59,    60,    61,    62,     0,     1,    24,     3,    24,    40,
-      24,    38,    24,    41,    25,    74,    41,     1,     1,    25,
-      79,    39,    81,    82,    83,    84,    85,    86,   138,    41,
-      41,    43,    91,    92,    93,     4,    42,    96,     7,    41,
-      24,    24,    38,   126,    17,    18,     1,     1,   107,   159,
-     133,     6,     1,    23,     9,    39,    39,   124,    13,    14,
-      33,     1,    23,    18,    19,    20,    21,    22,   127,    24,
-      24,    26,   155,   140,    14,    24,   135,   136,   137,     1,
-      35,    40,     1,    38,    41,    39,    41,    42,    43,     1,
-      39,    38,    14,    15,     6,    14,    15,     9,     1,   158,
-       3,    13,    14,     1,    40,   164,    18,    19,    20,    21,
-      22,    42,    24,    44,    26,    44,    14,    15,    33,    34,
-      44,    36,    37,    35,     1,    41,    38,    39,    40,     6,
-      42,    41,     9,    43,    36,    37,    13,    14,    23,    23,
-      23,    18,    19,    20,    21,    22,    41,    24,    43,    26,
-      41,     1,    43,    30,     0,     1,     6,     3,    35,     9,
-      41,    38,    43,    13,    14,    42,    40,    38,    18,    19,
-      20,    21,    22,     7,    24,    44,    26,     0,     1,    23,
-       3,    24,    23,     4,    41,    35,     1,    42,    38,    37,
-      44,    24,    42,     5,    24,    29,    30,    31,    32,    33,
-      34,    40,    36,    37,    41,    23,    42,    41,    29,    30,
+      39,     0,     1,   127,     3,    23,    95,    14,    25,   133,
+      49,    25,    51,    52,     1,    54,    38,     1,    25,    26,
+      59,    60,    61,    62,    40,    42,    40,     1,     1,     7,
+       0,   155,     8,     1,    41,    74,    41,    24,     1,    38,
+      24,    80,    23,    82,    83,    84,    85,    86,    87,   138,
+      24,    24,    39,    92,    93,    94,    24,    41,    97,    43,
+       7,    24,    38,    41,    23,    39,    39,     1,     1,   108,
+     159,    39,     6,    38,    41,     9,    39,     1,    25,    13,
+      14,     1,     1,     3,    18,    19,    20,    21,    22,   128,
+      24,    24,    26,    44,    41,    14,   135,   136,   137,   125,
+      24,    35,    40,     1,    38,    17,    18,    41,    42,    43,
+       1,    42,    23,    44,   140,     6,    14,    15,     9,   158,
+      41,    33,    13,    14,    23,   164,     1,    18,    19,    20,
+      21,    22,    41,    24,    43,    26,    44,     1,     4,    14,
+      15,     7,     6,    23,    35,     9,    40,    38,    39,    13,
+      14,    42,    36,    37,    18,    19,    20,    21,    22,    41,
+      24,    43,    26,    41,     1,    43,    30,     0,     1,     6,
+       3,    35,     9,    41,    38,    43,    13,    14,    42,     1,
+      38,    18,    19,    20,    21,    22,    40,    24,    44,    26,
+      24,     1,    14,    15,     0,     1,     6,     3,    35,     9,
+      23,    38,    23,    13,    14,    42,    41,    37,    18,    19,
+      20,    21,    22,     7,    24,    42,    26,    33,    34,    24,
+      36,    37,    24,     4,    44,    35,    40,    42,    38,    41,
+      23,    17,    42,     5,     1,    29,    30,    31,    32,    33,
+      34,    15,    36,    37,   123,    35,    37,    41,    29,    30,
       31,    32,    33,    34,    10,    36,    37,    29,    30,    31,
-      32,    33,    34,    17,    36,    37,    11,    15,   122,     1,
-      35,    37,    -1,    29,    30,    31,    32,    33,    34,    12,
+      32,    33,    34,    -1,    36,    37,    11,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    31,    32,    33,    34,    12,
       36,    37,    -1,    -1,    29,    30,    31,    32,    33,    34,
       -1,    36,    37,    16,    -1,    -1,    29,    30,    31,    32,
       33,    34,    -1,    36,    37,    -1,    29,    30,    31,    32,
@@ -801,9 +842,9 @@ static const yytype_int16 yycheck[] =
       31,    32,    33,    34,    -1,    36,    37
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
        0,     1,     3,    46,    47,    48,    38,    47,    23,     0,
        1,    48,     1,    24,    49,    50,     8,    38,    41,    42,
@@ -812,20 +853,20 @@ static const yytype_uint8 yystos[] =
       40,    49,    40,    55,    23,     1,    56,    44,     1,     6,
        9,    13,    14,    18,    19,    20,    21,    22,    24,    26,
       35,    38,    42,    51,    39,    23,    51,     1,    24,    52,
-      51,    51,    23,    51,    25,    42,    51,    51,    51,    57,
-      51,    29,    30,    31,    32,    33,    34,    36,    37,    40,
-      40,    38,    12,     7,    41,    44,    10,    16,    51,     1,
-      51,    58,    40,    39,    40,    51,    43,    30,    51,    51,
-      51,    51,    51,    51,    23,    24,    51,    51,    51,    52,
-      23,    51,     1,    14,    53,    54,    41,    41,    43,     1,
+      51,    51,    23,    51,    25,    42,    51,    51,     1,    51,
+      57,    51,    29,    30,    31,    32,    33,    34,    36,    37,
+      40,    40,    38,    12,     7,    41,    44,    10,    16,    51,
+       1,    51,    58,    40,    40,    39,    51,    43,    30,    51,
+      51,    51,    51,    51,    51,    23,    24,    51,    51,    51,
+      52,    23,    51,     1,    14,    53,    54,    41,    41,    43,
       40,    51,    37,    42,    39,     4,     7,    25,    41,    11,
       53,    24,     1,    15,    54,    58,    51,    24,    58,    40,
       51,    51,    51,    52,    44,    42,    43,     5,     7,    41,
       23,    58,    51,    52,    17,    43,    51,    40,    15
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
 {
        0,    45,    46,    47,    47,    47,    48,    48,    48,    48,
       49,    49,    49,    49,    50,    50,    50,    50,    51,    51,
@@ -836,8 +877,8 @@ static const yytype_uint8 yyr1[] =
       56,    57,    57,    57,    58,    58,    58,    58
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     1,     2,     2,     6,     8,     5,     1,
        0,     1,     2,     3,    10,     6,     4,     1,     3,     7,
@@ -845,43 +886,43 @@ static const yytype_uint8 yyr2[] =
        4,     3,     2,     3,     2,     1,     1,     1,     1,     2,
        6,     4,     8,     1,     5,     7,     5,     7,     3,     3,
        1,     2,     2,     8,     1,     0,     1,     3,     3,     3,
-       1,     2,     3,     3,     1,     3,     0,     3
+       1,     2,     3,     2,     1,     3,     0,     3
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -925,20 +966,27 @@ do {                                            \
 } while (0)
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
 YY_ATTRIBUTE_UNUSED
-static unsigned
+static int
 yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
 {
-  unsigned res = 0;
+  int res = 0;
   int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
   if (0 <= yylocp->first_line)
     {
@@ -958,63 +1006,71 @@ yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
         res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location); \
+                  Kind, Value, Location); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
-  YYUSE (yylocationp);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyoutput, *yylocationp);
-  YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp);
-  YYFPRINTF (yyoutput, ")");
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1023,7 +1079,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYL
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1046,21 +1102,22 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1075,8 +1132,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1099,250 +1156,31 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
 
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
 
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -1357,6 +1195,8 @@ YYLTYPE yylloc
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -1364,53 +1204,45 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-       'yyls': related to locations.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-    /* The location stack.  */
+    /* The location stack: array, bottom, top.  */
     YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
-
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
-
-    YYSIZE_T yystacksize;
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -1418,43 +1250,58 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
+
+/* User initialization code.  */
+#line 155 "cool.y"
+{
+      if (TimeReport *report = TimeReport::get()) report->begin("parse", NULL);
+    }
+
+#line 1265 "cool.tab.c"
+
   yylsp[0] = yylloc;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
         YYLTYPE *yyls1 = yyls;
 
         /* Each stack pointer address is followed by the size of the
@@ -1462,32 +1309,29 @@ yyparse (void)
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
-                    &yyls1, yysize * sizeof (*yylsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
                     &yystacksize);
-
-        yyls = yyls1;
         yyss = yyss1;
         yyvs = yyvs1;
+        yyls = yyls1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
         YYSTACK_RELOCATE (yyls_alloc, yyls);
@@ -1496,31 +1340,32 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1531,18 +1376,30 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1570,15 +1427,14 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1593,7 +1449,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -1609,410 +1465,413 @@ yyreduce:
      GCC warning that YYVAL may be used uninitialized.  */
   yyval = yyvsp[1-yylen];
 
-  /* Default location.  */
+  /* Default location. */
   YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 167 "cool.y" /* yacc.c:1646  */
-    { (yyloc) = (yylsp[0]); ast_root = program((yyvsp[0].classes)); }
-#line 1621 "cool.tab.c" /* yacc.c:1646  */
+  case 2: /* program: class_list  */
+#line 174 "cool.y"
+                                { (yyloc) = (yylsp[0]); ast_root = program((yyvsp[0].classes));
+                          if (TimeReport *report = TimeReport::get()) report->end(); }
+#line 1479 "cool.tab.c"
     break;
 
-  case 3:
-#line 172 "cool.y" /* yacc.c:1646  */
-    { (yyval.classes) = single_Classes((yyvsp[0].class_)); parse_results = (yyval.classes); }
-#line 1627 "cool.tab.c" /* yacc.c:1646  */
+  case 3: /* class_list: class  */
+#line 180 "cool.y"
+        { (yyval.classes) = single_Classes((yyvsp[0].class_)); parse_results = (yyval.classes); }
+#line 1485 "cool.tab.c"
     break;
 
-  case 4:
-#line 174 "cool.y" /* yacc.c:1646  */
-    { (yyval.classes) = append_Classes((yyvsp[-1].classes),single_Classes((yyvsp[0].class_))); parse_results = (yyval.classes); }
-#line 1633 "cool.tab.c" /* yacc.c:1646  */
+  case 4: /* class_list: class_list class  */
+#line 182 "cool.y"
+        { (yyval.classes) = append_Classes((yyvsp[-1].classes),single_Classes((yyvsp[0].class_))); parse_results = (yyval.classes); }
+#line 1491 "cool.tab.c"
     break;
 
-  case 5:
-#line 176 "cool.y" /* yacc.c:1646  */
-    { (yyval.classes) = (yyvsp[0].classes); }
-#line 1639 "cool.tab.c" /* yacc.c:1646  */
+  case 5: /* class_list: error class_list  */
+#line 184 "cool.y"
+        { (yyval.classes) = (yyvsp[0].classes); }
+#line 1497 "cool.tab.c"
     break;
 
-  case 6:
-#line 181 "cool.y" /* yacc.c:1646  */
-    { (yyval.class_) = class_((yyvsp[-4].symbol),idtable.add_string("Object"),(yyvsp[-2].features),
+  case 6: /* class: CLASS TYPEID '{' feature_list '}' ';'  */
+#line 189 "cool.y"
+        { (yyval.class_) = class_((yyvsp[-4].symbol),idtable.add_string("Object"),(yyvsp[-2].features),
     stringtable.add_string(curr_filename)); }
-#line 1646 "cool.tab.c" /* yacc.c:1646  */
+#line 1504 "cool.tab.c"
     break;
 
-  case 7:
-#line 184 "cool.y" /* yacc.c:1646  */
-    { (yyval.class_) = class_((yyvsp[-6].symbol),(yyvsp[-4].symbol),(yyvsp[-2].features),stringtable.add_string(curr_filename)); }
-#line 1652 "cool.tab.c" /* yacc.c:1646  */
+  case 7: /* class: CLASS TYPEID INHERITS TYPEID '{' feature_list '}' ';'  */
+#line 192 "cool.y"
+        { (yyval.class_) = class_((yyvsp[-6].symbol),(yyvsp[-4].symbol),(yyvsp[-2].features),stringtable.add_string(curr_filename)); }
+#line 1510 "cool.tab.c"
     break;
 
-  case 8:
-#line 186 "cool.y" /* yacc.c:1646  */
-    { (yyval.class_) = NULL;}
-#line 1658 "cool.tab.c" /* yacc.c:1646  */
+  case 8: /* class: error '{' feature_list '}' ';'  */
+#line 194 "cool.y"
+        { (yyval.class_) = NULL;}
+#line 1516 "cool.tab.c"
     break;
 
-  case 9:
-#line 188 "cool.y" /* yacc.c:1646  */
-    { (yyval.class_) = NULL;}
-#line 1664 "cool.tab.c" /* yacc.c:1646  */
+  case 9: /* class: error  */
+#line 196 "cool.y"
+        { (yyval.class_) = NULL;}
+#line 1522 "cool.tab.c"
     break;
 
-  case 10:
-#line 194 "cool.y" /* yacc.c:1646  */
-    {  (yyval.features) = nil_Features(); }
-#line 1670 "cool.tab.c" /* yacc.c:1646  */
+  case 10: /* feature_list: %empty  */
+#line 202 "cool.y"
+        {  (yyval.features) = nil_Features(); }
+#line 1528 "cool.tab.c"
     break;
 
-  case 11:
-#line 196 "cool.y" /* yacc.c:1646  */
-    { (yyval.features) = single_Features((yyvsp[0].feature)); }
-#line 1676 "cool.tab.c" /* yacc.c:1646  */
+  case 11: /* feature_list: feature  */
+#line 204 "cool.y"
+        { (yyval.features) = single_Features((yyvsp[0].feature)); }
+#line 1534 "cool.tab.c"
     break;
 
-  case 12:
-#line 198 "cool.y" /* yacc.c:1646  */
-    { (yyval.features) = append_Features((yyvsp[-1].features), single_Features((yyvsp[0].feature))); }
-#line 1682 "cool.tab.c" /* yacc.c:1646  */
+  case 12: /* feature_list: feature_list feature  */
+#line 206 "cool.y"
+        { (yyval.features) = append_Features((yyvsp[-1].features), single_Features((yyvsp[0].feature))); }
+#line 1540 "cool.tab.c"
     break;
 
-  case 13:
-#line 200 "cool.y" /* yacc.c:1646  */
-    { (yyval.features) = (yyvsp[0].features); }
-#line 1688 "cool.tab.c" /* yacc.c:1646  */
+  case 13: /* feature_list: error ',' feature_list  */
+#line 208 "cool.y"
+        { (yyval.features) = (yyvsp[0].features); }
+#line 1546 "cool.tab.c"
     break;
 
-  case 14:
-#line 205 "cool.y" /* yacc.c:1646  */
-    { (yyval.feature) = method((yyvsp[-9].symbol),(yyvsp[-7].formals),(yyvsp[-4].symbol),(yyvsp[-2].expression)); }
-#line 1694 "cool.tab.c" /* yacc.c:1646  */
+  case 14: /* feature: OBJECTID '(' formal_list ')' ':' TYPEID '{' expression '}' ';'  */
+#line 213 "cool.y"
+        { (yyval.feature) = method((yyvsp[-9].symbol),(yyvsp[-7].formals),(yyvsp[-4].symbol),(yyvsp[-2].expression)); }
+#line 1552 "cool.tab.c"
     break;
 
-  case 15:
-#line 207 "cool.y" /* yacc.c:1646  */
-    { (yyval.feature) = attr((yyvsp[-5].symbol),(yyvsp[-3].symbol),(yyvsp[-1].expression)); }
-#line 1700 "cool.tab.c" /* yacc.c:1646  */
+  case 15: /* feature: OBJECTID ':' TYPEID ASSIGN expression ';'  */
+#line 215 "cool.y"
+        { (yyval.feature) = attr((yyvsp[-5].symbol),(yyvsp[-3].symbol),(yyvsp[-1].expression)); }
+#line 1558 "cool.tab.c"
     break;
 
-  case 16:
-#line 209 "cool.y" /* yacc.c:1646  */
-    { (yyval.feature) = attr((yyvsp[-3].symbol),(yyvsp[-1].symbol), no_expr()); }
-#line 1706 "cool.tab.c" /* yacc.c:1646  */
+  case 16: /* feature: OBJECTID ':' TYPEID ';'  */
+#line 217 "cool.y"
+        { (yyval.feature) = attr((yyvsp[-3].symbol),(yyvsp[-1].symbol), no_expr()); }
+#line 1564 "cool.tab.c"
     break;
 
-  case 17:
-#line 211 "cool.y" /* yacc.c:1646  */
-    {(yyval.feature) = NULL;}
-#line 1712 "cool.tab.c" /* yacc.c:1646  */
+  case 17: /* feature: error  */
+#line 219 "cool.y"
+        {(yyval.feature) = NULL;}
+#line 1570 "cool.tab.c"
     break;
 
-  case 18:
-#line 216 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = assign((yyvsp[-2].symbol), (yyvsp[0].expression)); }
-#line 1718 "cool.tab.c" /* yacc.c:1646  */
+  case 18: /* expression: OBJECTID ASSIGN expression  */
+#line 224 "cool.y"
+        { (yyval.expression) = assign((yyvsp[-2].symbol), (yyvsp[0].expression)); }
+#line 1576 "cool.tab.c"
     break;
 
-  case 19:
-#line 218 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = cond((yyvsp[-5].expression),(yyvsp[-3].expression),(yyvsp[-1].expression)); }
-#line 1724 "cool.tab.c" /* yacc.c:1646  */
+  case 19: /* expression: IF expression THEN expression ELSE expression FI  */
+#line 226 "cool.y"
+        { (yyval.expression) = cond((yyvsp[-5].expression),(yyvsp[-3].expression),(yyvsp[-1].expression)); }
+#line 1582 "cool.tab.c"
     break;
 
-  case 20:
-#line 220 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = block((yyvsp[-1].expressions)); }
-#line 1730 "cool.tab.c" /* yacc.c:1646  */
+  case 20: /* expression: '{' expression_list_colon '}'  */
+#line 228 "cool.y"
+        { (yyval.expression) = block((yyvsp[-1].expressions)); }
+#line 1588 "cool.tab.c"
     break;
 
-  case 21:
-#line 222 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = loop((yyvsp[-3].expression),(yyvsp[-1].expression)); }
-#line 1736 "cool.tab.c" /* yacc.c:1646  */
+  case 21: /* expression: WHILE expression LOOP expression POOL  */
+#line 230 "cool.y"
+        { (yyval.expression) = loop((yyvsp[-3].expression),(yyvsp[-1].expression)); }
+#line 1594 "cool.tab.c"
     break;
 
-  case 22:
-#line 224 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = typcase((yyvsp[-3].expression),(yyvsp[-1].cases)); }
-#line 1742 "cool.tab.c" /* yacc.c:1646  */
+  case 22: /* expression: CASE expression OF case_list ESAC  */
+#line 232 "cool.y"
+        { (yyval.expression) = typcase((yyvsp[-3].expression),(yyvsp[-1].cases)); }
+#line 1600 "cool.tab.c"
     break;
 
-  case 23:
-#line 226 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = new_((yyvsp[0].symbol)); }
-#line 1748 "cool.tab.c" /* yacc.c:1646  */
+  case 23: /* expression: NEW TYPEID  */
+#line 234 "cool.y"
+        { (yyval.expression) = new_((yyvsp[0].symbol)); }
+#line 1606 "cool.tab.c"
     break;
 
-  case 24:
-#line 228 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = isvoid((yyvsp[0].expression)); }
-#line 1754 "cool.tab.c" /* yacc.c:1646  */
+  case 24: /* expression: ISVOID expression  */
+#line 236 "cool.y"
+        { (yyval.expression) = isvoid((yyvsp[0].expression)); }
+#line 1612 "cool.tab.c"
     break;
 
-  case 25:
-#line 230 "cool.y" /* yacc.c:1646  */
-    {(yyval.expression) = plus((yyvsp[-2].expression),(yyvsp[0].expression)); }
-#line 1760 "cool.tab.c" /* yacc.c:1646  */
+  case 25: /* expression: expression '+' expression  */
+#line 238 "cool.y"
+        {(yyval.expression) = plus((yyvsp[-2].expression),(yyvsp[0].expression)); }
+#line 1618 "cool.tab.c"
     break;
 
-  case 26:
-#line 232 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = sub((yyvsp[-2].expression),(yyvsp[0].expression)); }
-#line 1766 "cool.tab.c" /* yacc.c:1646  */
+  case 26: /* expression: expression '-' expression  */
+#line 240 "cool.y"
+        { (yyval.expression) = sub((yyvsp[-2].expression),(yyvsp[0].expression)); }
+#line 1624 "cool.tab.c"
     break;
 
-  case 27:
-#line 234 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = mul((yyvsp[-2].expression),(yyvsp[0].expression)); }
-#line 1772 "cool.tab.c" /* yacc.c:1646  */
+  case 27: /* expression: expression '*' expression  */
+#line 242 "cool.y"
+        { (yyval.expression) = mul((yyvsp[-2].expression),(yyvsp[0].expression)); }
+#line 1630 "cool.tab.c"
     break;
 
-  case 28:
-#line 236 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = divide((yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1778 "cool.tab.c" /* yacc.c:1646  */
+  case 28: /* expression: expression '/' expression  */
+#line 244 "cool.y"
+        { (yyval.expression) = divide((yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1636 "cool.tab.c"
     break;
 
-  case 29:
-#line 238 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = lt((yyvsp[-2].expression),(yyvsp[0].expression)); }
-#line 1784 "cool.tab.c" /* yacc.c:1646  */
+  case 29: /* expression: expression '<' expression  */
+#line 246 "cool.y"
+        { (yyval.expression) = lt((yyvsp[-2].expression),(yyvsp[0].expression)); }
+#line 1642 "cool.tab.c"
     break;
 
-  case 30:
-#line 240 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = leq((yyvsp[-3].expression),(yyvsp[0].expression)); }
-#line 1790 "cool.tab.c" /* yacc.c:1646  */
+  case 30: /* expression: expression '<' '=' expression  */
+#line 248 "cool.y"
+        { (yyval.expression) = leq((yyvsp[-3].expression),(yyvsp[0].expression)); }
+#line 1648 "cool.tab.c"
     break;
 
-  case 31:
-#line 242 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = eq((yyvsp[-2].expression),(yyvsp[0].expression)); }
-#line 1796 "cool.tab.c" /* yacc.c:1646  */
+  case 31: /* expression: expression '=' expression  */
+#line 250 "cool.y"
+        { (yyval.expression) = eq((yyvsp[-2].expression),(yyvsp[0].expression)); }
+#line 1654 "cool.tab.c"
     break;
 
-  case 32:
-#line 244 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = neg((yyvsp[0].expression)); }
-#line 1802 "cool.tab.c" /* yacc.c:1646  */
+  case 32: /* expression: '~' expression  */
+#line 252 "cool.y"
+        { (yyval.expression) = neg((yyvsp[0].expression)); }
+#line 1660 "cool.tab.c"
     break;
 
-  case 33:
-#line 246 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = (yyvsp[-1].expression); }
-#line 1808 "cool.tab.c" /* yacc.c:1646  */
+  case 33: /* expression: '(' expression ')'  */
+#line 254 "cool.y"
+        { (yyval.expression) = (yyvsp[-1].expression); }
+#line 1666 "cool.tab.c"
     break;
 
-  case 34:
-#line 248 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = comp((yyvsp[0].expression)); }
-#line 1814 "cool.tab.c" /* yacc.c:1646  */
+  case 34: /* expression: NOT expression  */
+#line 256 "cool.y"
+        { (yyval.expression) = comp((yyvsp[0].expression)); }
+#line 1672 "cool.tab.c"
     break;
 
-  case 35:
-#line 250 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = object((yyvsp[0].symbol)); }
-#line 1820 "cool.tab.c" /* yacc.c:1646  */
+  case 35: /* expression: OBJECTID  */
+#line 258 "cool.y"
+        { (yyval.expression) = object((yyvsp[0].symbol)); }
+#line 1678 "cool.tab.c"
     break;
 
-  case 36:
-#line 252 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = string_const((yyvsp[0].symbol)); }
-#line 1826 "cool.tab.c" /* yacc.c:1646  */
+  case 36: /* expression: STR_CONST  */
+#line 260 "cool.y"
+        { (yyval.expression) = string_const((yyvsp[0].symbol)); }
+#line 1684 "cool.tab.c"
     break;
 
-  case 37:
-#line 254 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = int_const((yyvsp[0].symbol)); }
-#line 1832 "cool.tab.c" /* yacc.c:1646  */
+  case 37: /* expression: INT_CONST  */
+#line 262 "cool.y"
+        { (yyval.expression) = int_const((yyvsp[0].symbol)); }
+#line 1690 "cool.tab.c"
     break;
 
-  case 38:
-#line 256 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = bool_const((yyvsp[0].boolean)); }
-#line 1838 "cool.tab.c" /* yacc.c:1646  */
+  case 38: /* expression: BOOL_CONST  */
+#line 264 "cool.y"
+        { (yyval.expression) = bool_const((yyvsp[0].boolean)); }
+#line 1696 "cool.tab.c"
     break;
 
-  case 39:
-#line 258 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = (yyvsp[0].expression); }
-#line 1844 "cool.tab.c" /* yacc.c:1646  */
+  case 39: /* expression: LET let_expression  */
+#line 266 "cool.y"
+        { (yyval.expression) = (yyvsp[0].expression); }
+#line 1702 "cool.tab.c"
     break;
 
-  case 40:
-#line 260 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = dispatch((yyvsp[-5].expression),(yyvsp[-3].symbol),(yyvsp[-1].expressions)); }
-#line 1850 "cool.tab.c" /* yacc.c:1646  */
+  case 40: /* expression: expression '.' OBJECTID '(' expression_list_comma ')'  */
+#line 268 "cool.y"
+        { (yyval.expression) = dispatch((yyvsp[-5].expression),(yyvsp[-3].symbol),(yyvsp[-1].expressions)); }
+#line 1708 "cool.tab.c"
     break;
 
-  case 41:
-#line 262 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = dispatch(object(idtable.add_string("self")),(yyvsp[-3].symbol),(yyvsp[-1].expressions)); }
-#line 1856 "cool.tab.c" /* yacc.c:1646  */
+  case 41: /* expression: OBJECTID '(' expression_list_comma ')'  */
+#line 270 "cool.y"
+        { (yyval.expression) = dispatch(object(idtable.add_string("self")),(yyvsp[-3].symbol),(yyvsp[-1].expressions)); }
+#line 1714 "cool.tab.c"
     break;
 
-  case 42:
-#line 264 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = static_dispatch((yyvsp[-7].expression),(yyvsp[-5].symbol),(yyvsp[-3].symbol),(yyvsp[-1].expressions));}
-#line 1862 "cool.tab.c" /* yacc.c:1646  */
+  case 42: /* expression: expression '@' TYPEID '.' OBJECTID '(' expression_list_comma ')'  */
+#line 272 "cool.y"
+        { (yyval.expression) = static_dispatch((yyvsp[-7].expression),(yyvsp[-5].symbol),(yyvsp[-3].symbol),(yyvsp[-1].expressions));}
+#line 1720 "cool.tab.c"
     break;
 
-  case 43:
-#line 266 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = NULL; }
-#line 1868 "cool.tab.c" /* yacc.c:1646  */
+  case 43: /* expression: error  */
+#line 274 "cool.y"
+        { (yyval.expression) = NULL; }
+#line 1726 "cool.tab.c"
     break;
 
-  case 44:
-#line 271 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = let((yyvsp[-4].symbol), (yyvsp[-2].symbol), no_expr(), (yyvsp[0].expression)); }
-#line 1874 "cool.tab.c" /* yacc.c:1646  */
+  case 44: /* let_expression: OBJECTID ':' TYPEID IN expression  */
+#line 279 "cool.y"
+            { (yyval.expression) = let((yyvsp[-4].symbol), (yyvsp[-2].symbol), no_expr(), (yyvsp[0].expression)); }
+#line 1732 "cool.tab.c"
     break;
 
-  case 45:
-#line 273 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = let((yyvsp[-6].symbol), (yyvsp[-4].symbol), (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1880 "cool.tab.c" /* yacc.c:1646  */
+  case 45: /* let_expression: OBJECTID ':' TYPEID ASSIGN expression IN expression  */
+#line 281 "cool.y"
+            { (yyval.expression) = let((yyvsp[-6].symbol), (yyvsp[-4].symbol), (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1738 "cool.tab.c"
     break;
 
-  case 46:
-#line 275 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = let((yyvsp[-4].symbol), (yyvsp[-2].symbol), no_expr(), (yyvsp[0].expression)); }
-#line 1886 "cool.tab.c" /* yacc.c:1646  */
+  case 46: /* let_expression: OBJECTID ':' TYPEID ',' let_expression  */
+#line 283 "cool.y"
+            { (yyval.expression) = let((yyvsp[-4].symbol), (yyvsp[-2].symbol), no_expr(), (yyvsp[0].expression)); }
+#line 1744 "cool.tab.c"
     break;
 
-  case 47:
-#line 277 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = let((yyvsp[-6].symbol), (yyvsp[-4].symbol), (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1892 "cool.tab.c" /* yacc.c:1646  */
+  case 47: /* let_expression: OBJECTID ':' TYPEID ASSIGN expression ',' let_expression  */
+#line 285 "cool.y"
+            { (yyval.expression) = let((yyvsp[-6].symbol), (yyvsp[-4].symbol), (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1750 "cool.tab.c"
     break;
 
-  case 48:
-#line 279 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = NULL; }
-#line 1898 "cool.tab.c" /* yacc.c:1646  */
+  case 48: /* let_expression: error IN expression  */
+#line 287 "cool.y"
+            { (yyval.expression) = NULL; }
+#line 1756 "cool.tab.c"
     break;
 
-  case 49:
-#line 281 "cool.y" /* yacc.c:1646  */
-    { (yyval.expression) = NULL;  }
-#line 1904 "cool.tab.c" /* yacc.c:1646  */
+  case 49: /* let_expression: error ',' let_expression  */
+#line 289 "cool.y"
+            { (yyval.expression) = NULL;  }
+#line 1762 "cool.tab.c"
     break;
 
-  case 50:
-#line 286 "cool.y" /* yacc.c:1646  */
-    { (yyval.cases) = single_Cases((yyvsp[0].case_)); }
-#line 1910 "cool.tab.c" /* yacc.c:1646  */
+  case 50: /* case_list: case  */
+#line 294 "cool.y"
+        { (yyval.cases) = single_Cases((yyvsp[0].case_)); }
+#line 1768 "cool.tab.c"
     break;
 
-  case 51:
-#line 288 "cool.y" /* yacc.c:1646  */
-    { (yyval.cases) = append_Cases((yyvsp[-1].cases), single_Cases((yyvsp[0].case_))); }
-#line 1916 "cool.tab.c" /* yacc.c:1646  */
+  case 51: /* case_list: case_list case  */
+#line 296 "cool.y"
+        { (yyval.cases) = append_Cases((yyvsp[-1].cases), single_Cases((yyvsp[0].case_))); }
+#line 1774 "cool.tab.c"
     break;
 
-  case 52:
-#line 290 "cool.y" /* yacc.c:1646  */
-    { (yyval.cases) = (yyvsp[0].cases); }
-#line 1922 "cool.tab.c" /* yacc.c:1646  */
+  case 52: /* case_list: error case_list  */
+#line 298 "cool.y"
+        { (yyval.cases) = (yyvsp[0].cases); }
+#line 1780 "cool.tab.c"
     break;
 
-  case 53:
-#line 295 "cool.y" /* yacc.c:1646  */
-    { (yyval.case_) = branch((yyvsp[-6].symbol),(yyvsp[-4].symbol),(yyvsp[-2].expression));}
-#line 1928 "cool.tab.c" /* yacc.c:1646  */
+  case 53: /* case: CASE OBJECTID ':' TYPEID DARROW expression ';' ESAC  */
+#line 303 "cool.y"
+        { (yyval.case_) = branch((yyvsp[-6].symbol),(yyvsp[-4].symbol),(yyvsp[-2].expression));}
+#line 1786 "cool.tab.c"
     break;
 
-  case 54:
-#line 297 "cool.y" /* yacc.c:1646  */
-    { (yyval.case_) = NULL; }
-#line 1934 "cool.tab.c" /* yacc.c:1646  */
+  case 54: /* case: error  */
+#line 305 "cool.y"
+        { (yyval.case_) = NULL; }
+#line 1792 "cool.tab.c"
     break;
 
-  case 55:
-#line 302 "cool.y" /* yacc.c:1646  */
-    {  (yyval.formals) = nil_Formals(); }
-#line 1940 "cool.tab.c" /* yacc.c:1646  */
+  case 55: /* formal_list: %empty  */
+#line 310 "cool.y"
+        {  (yyval.formals) = nil_Formals(); }
+#line 1798 "cool.tab.c"
     break;
 
-  case 56:
-#line 304 "cool.y" /* yacc.c:1646  */
-    { (yyval.formals) = single_Formals((yyvsp[0].formal)); }
-#line 1946 "cool.tab.c" /* yacc.c:1646  */
+  case 56: /* formal_list: formal  */
+#line 312 "cool.y"
+        { (yyval.formals) = single_Formals((yyvsp[0].formal)); }
+#line 1804 "cool.tab.c"
     break;
 
-  case 57:
-#line 306 "cool.y" /* yacc.c:1646  */
-    { (yyval.formals) = append_Formals((yyvsp[-2].formals), single_Formals((yyvsp[0].formal))); }
-#line 1952 "cool.tab.c" /* yacc.c:1646  */
+  case 57: /* formal_list: formal_list ',' formal  */
+#line 314 "cool.y"
+        { (yyval.formals) = append_Formals((yyvsp[-2].formals), single_Formals((yyvsp[0].formal))); }
+#line 1810 "cool.tab.c"
     break;
 
-  case 58:
-#line 308 "cool.y" /* yacc.c:1646  */
-    { (yyval.formals) = (yyvsp[0].formals); }
-#line 1958 "cool.tab.c" /* yacc.c:1646  */
+  case 58: /* formal_list: error ',' formal_list  */
+#line 316 "cool.y"
+        { (yyval.formals) = (yyvsp[0].formals); }
+#line 1816 "cool.tab.c"
     break;
 
-  case 59:
-#line 313 "cool.y" /* yacc.c:1646  */
-    { (yyval.formal) = formal((yyvsp[-2].symbol),(yyvsp[0].symbol)); }
-#line 1964 "cool.tab.c" /* yacc.c:1646  */
+  case 59: /* formal: OBJECTID ':' TYPEID  */
+#line 321 "cool.y"
+        { (yyval.formal) = formal((yyvsp[-2].symbol),(yyvsp[0].symbol)); }
+#line 1822 "cool.tab.c"
     break;
 
-  case 60:
-#line 315 "cool.y" /* yacc.c:1646  */
-    { (yyval.formal) = NULL; }
-#line 1970 "cool.tab.c" /* yacc.c:1646  */
+  case 60: /* formal: error  */
+#line 323 "cool.y"
+        { (yyval.formal) = NULL; }
+#line 1828 "cool.tab.c"
     break;
 
-  case 61:
-#line 319 "cool.y" /* yacc.c:1646  */
-    { (yyval.expressions) = single_Expressions((yyvsp[-1].expression)); }
-#line 1976 "cool.tab.c" /* yacc.c:1646  */
+  case 61: /* expression_list_colon: expression ';'  */
+#line 327 "cool.y"
+        { (yyval.expressions) = single_Expressions((yyvsp[-1].expression)); }
+#line 1834 "cool.tab.c"
     break;
 
-  case 62:
-#line 321 "cool.y" /* yacc.c:1646  */
-    { (yyval.expressions) =  append_Expressions((yyvsp[-2].expressions),single_Expressions((yyvsp[-1].expression))); }
-#line 1982 "cool.tab.c" /* yacc.c:1646  */
+  case 62: /* expression_list_colon: expression_list_colon expression ';'  */
+#line 329 "cool.y"
+        { (yyval.expressions) =  append_Expressions((yyvsp[-2].expressions),single_Expressions((yyvsp[-1].expression))); }
+#line 1840 "cool.tab.c"
     break;
 
-  case 63:
-#line 323 "cool.y" /* yacc.c:1646  */
-    { printf("error\n");(yyval.expressions) = (yyvsp[-2].expressions); }
-#line 1988 "cool.tab.c" /* yacc.c:1646  */
+  case 63: /* expression_list_colon: error ';'  */
+#line 331 "cool.y"
+        { (yyval.expressions) = NULL; }
+#line 1846 "cool.tab.c"
     break;
 
-  case 64:
-#line 328 "cool.y" /* yacc.c:1646  */
-    { (yyval.expressions) = single_Expressions((yyvsp[0].expression)); }
-#line 1994 "cool.tab.c" /* yacc.c:1646  */
+  case 64: /* expression_list_comma: expression  */
+#line 336 "cool.y"
+        { (yyval.expressions) = single_Expressions((yyvsp[0].expression)); }
+#line 1852 "cool.tab.c"
     break;
 
-  case 65:
-#line 330 "cool.y" /* yacc.c:1646  */
-    { (yyval.expressions) =  append_Expressions((yyvsp[-2].expressions),single_Expressions((yyvsp[0].expression))); }
-#line 2000 "cool.tab.c" /* yacc.c:1646  */
+  case 65: /* expression_list_comma: expression_list_comma ',' expression  */
+#line 338 "cool.y"
+        { (yyval.expressions) =  append_Expressions((yyvsp[-2].expressions),single_Expressions((yyvsp[0].expression))); }
+#line 1858 "cool.tab.c"
     break;
 
-  case 66:
-#line 332 "cool.y" /* yacc.c:1646  */
-    { (yyval.expressions) = nil_Expressions();}
-#line 2006 "cool.tab.c" /* yacc.c:1646  */
+  case 66: /* expression_list_comma: %empty  */
+#line 340 "cool.y"
+        { (yyval.expressions) = nil_Expressions();}
+#line 1864 "cool.tab.c"
     break;
 
-  case 67:
-#line 334 "cool.y" /* yacc.c:1646  */
-    { (yyval.expressions) = (yyvsp[0].expressions); }
-#line 2012 "cool.tab.c" /* yacc.c:1646  */
+  case 67: /* expression_list_comma: error ',' expression_list_comma  */
+#line 342 "cool.y"
+        { (yyval.expressions) = (yyvsp[0].expressions); }
+#line 1870 "cool.tab.c"
     break;
 
 
-#line 2016 "cool.tab.c" /* yacc.c:1646  */
+#line 1874 "cool.tab.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2026,11 +1885,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
@@ -2038,14 +1896,13 @@ yyreduce:
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -2056,50 +1913,15 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -2128,14 +1950,12 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  yyerror_range[1] = yylsp[1-yylen];
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
@@ -2151,13 +1971,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -2171,7 +1992,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2182,13 +2003,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2199,26 +2018,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -2234,20 +2057,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 338 "cool.y" /* yacc.c:1906  */
+
+#line 346 "cool.y"
 
     
     /* This function is called automatically when Bison detects a parse error. */
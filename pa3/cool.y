@@ -8,6 +8,8 @@
   #include "cool-tree.h"
   #include "stringtab.h"
   #include "utilities.h"
+  #define TIME_REPORT_PROCESS "parser"
+  #include "../common/time-report.h"
   
   extern char *curr_filename;
   
@@ -149,6 +151,11 @@
     %type <expressions> expression_list_comma
     %type <expressions> expression_list_colon
     
+    /* Time the parse when COOL_TIME_REPORT is set (see time-report.h). */
+    %initial-action {
+      if (TimeReport *report = TimeReport::get()) report->begin("parse", NULL);
+    }
+
     /* Precedence declarations go here. */
     %right ASSIGN
     %left NOT
@@ -164,7 +171,8 @@
     /* 
     Save the root of the abstract syntax tree in a global variable.
     */
-    program	: class_list	{ @$ = @1; ast_root = program($1); }
+    program	: class_list	{ @$ = @1; ast_root = program($1);
+                          if (TimeReport *report = TimeReport::get()) report->end(); }
     ;
     
     class_list
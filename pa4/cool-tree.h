@@ -10,6 +10,7 @@
 #include "tree.h"
 #include "cool-tree.handcode.h"
 #include "symtab.h"
+#include "../common/scoped-symtab.h"
 #include "semant.h"
 
 class ClassTable;
@@ -21,7 +22,7 @@ typedef ClassTable *ClassTableP;
 
 typedef std::vector<Symbol> Signature;
 typedef std::map<Symbol, Signature> FunctionEnvironment;
-typedef SymbolTable<Symbol, Entry> ObjectEnvironment;
+typedef ScopedSymbolTable<Symbol, Entry> ObjectEnvironment;
 
 // define the class for phylum
 // define simple phylum - Program
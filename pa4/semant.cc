@@ -8,6 +8,8 @@
 
 #include "semant.h"
 #include "utilities.h"
+#define TIME_REPORT_PROCESS "semant"
+#include "../common/time-report.h"
 
 
 extern int semant_debug;
@@ -879,14 +881,20 @@ void class__class::semant(ClassTableP ct, Symbol classname){
  */
 void program_class::semant()
 {
+    PhaseTimer timer("semant");
     initialize_constants();
 
     /* ClassTable constructor may do some semantic analysis */
-    ClassTable *classtable = new ClassTable(classes); // Sorted out the loops in the inheritance tree
+    ClassTable *classtable;
+    {
+    	PhaseTimer t("ClassTable");
+    	classtable = new ClassTable(classes); // Sorted out the loops in the inheritance tree
+    }
     for(int i = classes->first(); classes->more(i); i = classes->next(i)){
     	Class_ c = classes->nth(i);
     	if (c->get_name()==SELF_TYPE) continue;
     	if (c->get_name()==Object) continue;
+    	PhaseTimer t("typecheck", c->get_name()->get_string());
     	c->semant(classtable, c->get_name());
     }
 
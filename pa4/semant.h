@@ -6,6 +6,7 @@
 #include "cool-tree.h"
 #include "stringtab.h"
 #include "symtab.h"
+#include "../common/scoped-symtab.h"
 #include "list.h"
 
 #include <map>
@@ -23,7 +24,7 @@ typedef ClassTable *ClassTableP;
 typedef std::vector<Symbol> Signature;
 
 typedef std::map<Symbol, Signature> FunctionEnvironment;
-typedef SymbolTable<Symbol, Entry> ObjectEnvironment;
+typedef ScopedSymbolTable<Symbol, Entry> ObjectEnvironment;
 
 // This is a structure that may be used to contain the semantic
 // information such as the inheritance graph.  You may use it or not as
@@ -0,0 +1,116 @@
+//
+// asm-buffer.h
+//
+// In-memory output for the code generator.
+//
+// The emit_* functions write to an ostream.  Pointed at cout, which is
+// synchronized with stdio, every << turns into a call into the C
+// library, and every endl into a flush.  An AsmBuffer is a streambuf
+// that appends to a list of fixed size chunks instead, so the whole
+// module is built in memory and written out once at the end, with a
+// single writev when the destination is standard output.
+//
+
+#ifndef ASM_BUFFER_H
+#define ASM_BUFFER_H
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <iostream>
+#include <streambuf>
+#include <vector>
+
+class AsmBuffer : public std::streambuf
+{
+	enum { CHUNK = 1 << 20 };
+
+	std::vector<char *> chunks;
+
+	void new_chunk()
+	{
+		char *c = new char[CHUNK];
+		chunks.push_back(c);
+		setp(c, c + CHUNK);
+	}
+
+protected:
+	int_type overflow(int_type ch)
+	{
+		if (traits_type::eq_int_type(ch, traits_type::eof()))
+			return traits_type::not_eof(ch);
+		new_chunk();
+		*pptr() = traits_type::to_char_type(ch);
+		pbump(1);
+		return ch;
+	}
+
+	std::streamsize xsputn(const char *s, std::streamsize n)
+	{
+		std::streamsize left = n;
+		while (left > 0){
+			if (pptr() == epptr()) new_chunk();
+			std::streamsize room = epptr() - pptr();
+			std::streamsize k = left < room ? left : room;
+			memcpy(pptr(), s, k);
+			pbump(k);
+			s += k;
+			left -= k;
+		}
+		return n;
+	}
+
+public:
+	AsmBuffer() { new_chunk(); }
+
+	~AsmBuffer()
+	{
+		for (char *c : chunks) delete[] c;
+	}
+
+	size_t size() const
+	{
+		return (chunks.size() - 1) * (size_t) CHUNK + (pptr() - pbase());
+	}
+
+	// Writes everything emitted so far to os.
+	void write_to(std::ostream& os)
+	{
+		std::vector<struct iovec> iov(chunks.size());
+		for (size_t i = 0; i < chunks.size(); i++){
+			iov[i].iov_base = chunks[i];
+			iov[i].iov_len = i + 1 < chunks.size() ? (size_t) CHUNK : (size_t) (pptr() - pbase());
+		}
+
+		if (&os != &std::cout){
+			for (auto const& v : iov) os.write((const char *) v.iov_base, v.iov_len);
+			return;
+		}
+
+		// Anything cout or stdio still hold must go out first.
+		os.flush();
+		fflush(stdout);
+		size_t i = 0;
+		while (i < iov.size()){
+			int n = iov.size() - i < IOV_MAX ? iov.size() - i : IOV_MAX;
+			ssize_t w = writev(STDOUT_FILENO, &iov[i], n);
+			if (w < 0){
+				os.setstate(std::ios::badbit);
+				return;
+			}
+			// Skip what was written; a short write leaves a partial iovec.
+			while (i < iov.size() && (size_t) w >= iov[i].iov_len){
+				w -= iov[i].iov_len;
+				i++;
+			}
+			if (i < iov.size()){
+				iov[i].iov_base = (char *) iov[i].iov_base + w;
+				iov[i].iov_len -= w;
+			}
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,46 @@
+-- Attributes hold their defaults until their own initializer runs, even
+-- when that initializer is a constant: an earlier initializer, or one in
+-- a parent class that dispatches to an override, sees void, 0 or "".
+--
+-- Expected output:
+-- 0[]
+-- 1 10 3
+
+
+class Parent
+{
+  x : Int <- peek();
+
+  peek() : Int { 0 };
+};
+
+
+class Child inherits Parent
+{
+  k : Int <- 7;
+  s : String <- "s";
+
+  peek() : Int
+  {
+    {
+      (new IO).out_int( k ).out_string( "[" ).out_string( s ).out_string( "]\n" );
+      0;
+    }
+  };
+};
+
+
+class Main inherits IO
+{
+  a : Int <- b + 1;
+  b : Int <- 10;
+  c : Int <- 3;
+
+  main() : Object
+  {
+    {
+      new Child;
+      out_int( a ).out_string( " " ).out_int( b ).out_string( " " ).out_int( c ).out_string( "\n" );
+    }
+  };
+};
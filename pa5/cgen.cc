@@ -24,13 +24,22 @@
 
 #include "cgen.h"
 #include "cgen_gc.h"
+#define TIME_REPORT_PROCESS "cgen"
+#include "../common/time-report.h"
+#include "asm-buffer.h"
+#include "mips-code.h"
+#include "ir.h"
+#include "regalloc.h"
 #include <vector>
 #include <algorithm>
 #include <ostream>
 #include <sstream>
+#include <deque>
+#include <queue>
 
 extern void emit_string_constant(ostream& str, char *s);
 extern int cgen_debug;
+extern int cgen_optimize;
 
 //
 // Three symbols from the semantic analyzer (semant.cc) are used.
@@ -132,8 +141,14 @@ BoolConst truebool(TRUE);
 //
 //*********************************************************
 
-void program_class::cgen(ostream &os) 
+void program_class::cgen(ostream &out) 
 {
+  PhaseTimer timer("cgen");
+
+  // The module is built in memory and written out in one go.
+  AsmBuffer buffer;
+  ostream os(&buffer);
+
   // spim wants comments to start with '#'
   os << "# start of generated code\n";
 
@@ -141,6 +156,9 @@ void program_class::cgen(ostream &os)
   CgenClassTable *codegen_classtable = new CgenClassTable(classes,os);
 
   os << "\n# end of generated code\n";
+
+  PhaseTimer write_timer("write");
+  buffer.write_to(out);
 }
 
 
@@ -148,98 +166,102 @@ void program_class::cgen(ostream &os)
 //
 //  emit_* procedures
 //
-//  emit_X  writes code for operation "X" to the output stream.
-//  There is an emit_X for each opcode X, as well as emit_ functions
-//  for generating names according to the naming conventions (see emit.h)
-//  and calls to support functions defined in the trap handler.
+//  emit_X  appends an instruction for operation "X" to the MipsCode of
+//  the function being generated (see mips-code.h), which is optimized
+//  and printed once the function is complete.  There is an emit_X for
+//  each opcode X, as well as emit_ functions for generating names
+//  according to the naming conventions (see emit.h) and calls to
+//  support functions defined in the trap handler.
 //
 //  Register names and addresses are passed as strings.  See `emit.h'
 //  for symbolic names you can use to refer to the strings.
 //
 //////////////////////////////////////////////////////////////////////////////
-static void emit_load(char *dest_reg, int offset, char *source_reg, ostream& s)
-{
-  s << LW << dest_reg << " " << offset * WORD_SIZE << "(" << source_reg << ")" 
-    << endl;
-}
+static void emit_load(const char *dest_reg, int offset, const char *source_reg, MipsCode& s)
+{ s.rri(M_LW, dest_reg, source_reg, offset); }
 
-static void emit_store(char *source_reg, int offset, char *dest_reg, ostream& s)
-{
-  s << SW << source_reg << " " << offset * WORD_SIZE << "(" << dest_reg << ")"
-      << endl;
-}
+static void emit_store(const char *source_reg, int offset, const char *dest_reg, MipsCode& s)
+{ s.store(source_reg, offset, dest_reg); }
 
-static void emit_load_imm(char *dest_reg, int val, ostream& s)
-{ s << LI << dest_reg << " " << val << endl; }
+static void emit_load_imm(const char *dest_reg, int val, MipsCode& s)
+{ s.rri(M_LI, dest_reg, NULL, val); }
 
-static void emit_load_address(char *dest_reg, char *address, ostream& s)
-{ s << LA << dest_reg << " " << address << endl; }
+static void emit_load_address(const char *dest_reg, const char *address, MipsCode& s)
+{ s.ref(M_LA, dest_reg, MipsRef::name(address)); }
 
-static void emit_partial_load_address(char *dest_reg, ostream& s)
-{ s << LA << dest_reg << " "; }
+// b must outlive the MipsCode, so it is truebool or falsebool.
+static void emit_load_bool(const char *dest, const BoolConst& b, MipsCode& s)
+{ s.ref(M_LA, dest, MipsRef::bool_const(&b)); }
 
-static void emit_load_bool(char *dest, const BoolConst& b, ostream& s)
-{
-  emit_partial_load_address(dest,s);
-  b.code_ref(s);
-  s << endl;
-}
+static void emit_load_string(const char *dest, StringEntry *str, MipsCode& s)
+{ s.ref(M_LA, dest, MipsRef::string_const(str)); }
 
-static void emit_load_string(char *dest, StringEntry *str, ostream& s)
-{
-  emit_partial_load_address(dest,s);
-  str->code_ref(s);
-  s << endl;
-}
+static void emit_load_int(const char *dest, IntEntry *i, MipsCode& s)
+{ s.ref(M_LA, dest, MipsRef::int_const(i)); }
 
-static void emit_load_int(char *dest, IntEntry *i, ostream& s)
-{
-  emit_partial_load_address(dest,s);
-  i->code_ref(s);
-  s << endl;
-}
+static void emit_load_protobj(const char *dest, Symbol sym, MipsCode& s)
+{ s.ref(M_LA, dest, MipsRef::protobj(sym)); }
+
+static void emit_comment(const char *comment, MipsCode& s)
+{ s.comment(comment); }
+
+static void emit_move(const char *dest_reg, const char *source_reg, MipsCode& s)
+{ s.rri(M_MOVE, dest_reg, source_reg, 0); }
+
+static void emit_neg(const char *dest, const char *src1, MipsCode& s)
+{ s.rri(M_NEG, dest, src1, 0); }
 
-static void emit_comment(char *comment, ostream& s)
-{ s << "\t# "<< comment << endl;}
+static void emit_add(const char *dest, const char *src1, const char *src2, MipsCode& s)
+{ s.rrr(M_ADD, dest, src1, src2); }
 
-static void emit_move(char *dest_reg, char *source_reg, ostream& s)
-{ s << MOVE << dest_reg << " " << source_reg << endl; }
+static void emit_addu(const char *dest, const char *src1, const char *src2, MipsCode& s)
+{ s.rrr(M_ADDU, dest, src1, src2); }
 
-static void emit_neg(char *dest, char *src1, ostream& s)
-{ s << NEG << dest << " " << src1 << endl; }
+static void emit_addiu(const char *dest, const char *src1, int imm, MipsCode& s)
+{ 	if (imm !=0) s.rri(M_ADDIU, dest, src1, imm); }
 
-static void emit_add(char *dest, char *src1, char *src2, ostream& s)
-{ s << ADD << dest << " " << src1 << " " << src2 << endl; }
+static void emit_div(const char *dest, const char *src1, const char *src2, MipsCode& s)
+{ s.rrr(M_DIV, dest, src1, src2); }
 
-static void emit_addu(char *dest, char *src1, char *src2, ostream& s)
-{ s << ADDU << dest << " " << src1 << " " << src2 << endl; }
+static void emit_mul(const char *dest, const char *src1, const char *src2, MipsCode& s)
+{ s.rrr(M_MUL, dest, src1, src2); }
 
-static void emit_addiu(char *dest, char *src1, int imm, ostream& s)
-{ 	if (imm !=0)s << ADDIU << dest << " " << src1 << " " << imm << endl; }
+static void emit_sub(const char *dest, const char *src1, const char *src2, MipsCode& s)
+{ s.rrr(M_SUB, dest, src1, src2); }
 
-static void emit_div(char *dest, char *src1, char *src2, ostream& s)
-{ s << DIV << dest << " " << src1 << " " << src2 << endl; }
+static void emit_sll(const char *dest, const char *src1, int num, MipsCode& s)
+{ s.rri(M_SLL, dest, src1, num); }
 
-static void emit_mul(char *dest, char *src1, char *src2, ostream& s)
-{ s << MUL << dest << " " << src1 << " " << src2 << endl; }
+static void emit_jalr(const char *dest, MipsCode& s)
+{ s.rri(M_JALR, NULL, dest, 0); }
 
-static void emit_sub(char *dest, char *src1, char *src2, ostream& s)
-{ s << SUB << dest << " " << src1 << " " << src2 << endl; }
+static void emit_jal(const char *address, MipsCode &s)
+{ s.ref(M_JAL, NULL, MipsRef::name(address)); }
 
-static void emit_sll(char *dest, char *src1, int num, ostream& s)
-{ s << SLL << dest << " " << src1 << " " << num << endl; }
+static void emit_jal_init(Symbol sym, MipsCode &s)
+{ s.ref(M_JAL, NULL, MipsRef::init(sym)); }
 
-static void emit_jalr(char *dest, ostream& s)
-{ s << JALR << "\t" << dest << endl; }
+static void emit_jal_method(Symbol classname, Symbol methodname, MipsCode &s)
+{ s.ref(M_JAL, NULL, MipsRef::method(classname, methodname)); }
 
-static void emit_jal(char *address,ostream &s)
-{ s << JAL << address << endl; }
+static void emit_jump_method(Symbol classname, Symbol methodname, MipsCode &s)
+{ s.ref(M_J, NULL, MipsRef::method(classname, methodname)); }
 
-static void emit_return(ostream& s)
-{ s << RET << endl; }
+static void emit_jr(const char *dest, MipsCode& s)
+{ s.rri(M_JR, NULL, dest, 0); }
 
-static void emit_gc_assign(ostream& s)
-{ s << JAL << "_GenGC_Assign" << endl; }
+static void emit_return(MipsCode& s)
+{ s.add_op(M_RET); }
+
+static void emit_gc_assign(MipsCode& s)
+{ emit_jal("_GenGC_Assign", s); }
+
+// Tells the generational collector of a store to attribute offset of obj.
+static void emit_write_barrier(const char *obj, int offset, MipsCode& s)
+{
+  emit_addiu(A1, obj, WORD_SIZE * offset, s);
+  emit_gc_assign(s);
+}
 
 static void emit_disptable_ref(Symbol sym, ostream& s)
 {  s << sym << DISPTAB_SUFFIX; }
@@ -247,108 +269,49 @@ static void emit_disptable_ref(Symbol sym, ostream& s)
 static void emit_init_ref(Symbol sym, ostream& s)
 { s << sym << CLASSINIT_SUFFIX; }
 
-static void emit_label_ref(int l, ostream &s)
-{ s << "label" << l; }
-
 static void emit_protobj_ref(Symbol sym, ostream& s)
 { s << sym << PROTOBJ_SUFFIX; }
 
 static void emit_method_ref(Symbol classname, Symbol methodname, ostream& s)
 { s << classname << METHOD_SEP << methodname; }
 
-static void emit_label_def(int l, ostream &s)
-{
-  emit_label_ref(l,s);
-  s << ":" << endl;
-}
-
-static void emit_label_def(std::string const& label, ostream &s)
-{
-  s << label << ":" << endl;
-}
-
-static void emit_beqz(char *source, int label, ostream &s)
-{
-  s << BEQZ << source << " ";
-  emit_label_ref(label,s);
-  s << endl;
-}
-
-static void emit_beqz(char *source, std::string const& label, ostream &s)
-{
-  s << BEQZ << source << " " << label<<endl;
-}
+static void emit_label_def(int l, MipsCode &s)
+{ s.label(l); }
 
-static void emit_beq(char *src1, char *src2, std::string const& label, ostream &s)
-{
-  s << BEQ << src1 << " " << src2 << " " << label<< endl;
-}
+static void emit_beqz(const char *source, int label, MipsCode &s)
+{ s.branch(M_BEQZ, source, NULL, 0, label); }
 
-static void emit_beq(char *src1, char *src2, int label, ostream &s)
-{
-  s << BEQ << src1 << " " << src2 << " ";
-  emit_label_ref(label,s);
-  s << endl;
-}
+static void emit_beq(const char *src1, const char *src2, int label, MipsCode &s)
+{ s.branch(M_BEQ, src1, src2, 0, label); }
 
-static void emit_cmp(char const * const cmp, char *src1, char *src2, std::string const& label, ostream &s)
-{
-  s << cmp << src1 << " " << src2 << " " << label << endl;;
-}
+static void emit_cmp(MipsOp cmp, const char *src1, const char *src2, int label, MipsCode &s)
+{ s.branch(cmp, src1, src2, 0, label); }
 
-static void emit_bne(char *src1, char *src2, int label, ostream &s)
-{
-  s << BNE << src1 << " " << src2 << " ";
-  emit_label_ref(label,s);
-  s << endl;
-}
+static void emit_bnez(const char *source, int label, MipsCode &s)
+{ s.branch(M_BNEZ, source, NULL, 0, label); }
 
-static void emit_bleq(char *src1, char *src2, int label, ostream &s)
-{
-  s << BLEQ << src1 << " " << src2 << " ";
-  emit_label_ref(label,s);
-  s << endl;
-}
+static void emit_bne(const char *src1, const char *src2, int label, MipsCode &s)
+{ s.branch(M_BNE, src1, src2, 0, label); }
 
-static void emit_blt(char *src1, char *src2, int label, ostream &s)
-{
-  s << BLT << src1 << " " << src2 << " ";
-  emit_label_ref(label,s);
-  s << endl;
-}
+static void emit_bleq(const char *src1, const char *src2, int label, MipsCode &s)
+{ s.branch(M_BLE, src1, src2, 0, label); }
 
-static void emit_blti(char *src1, int imm, int label, ostream &s)
-{
-  s << BLT << src1 << " " << imm << " ";
-  emit_label_ref(label,s);
-  s << endl;
-}
+static void emit_blt(const char *src1, const char *src2, int label, MipsCode &s)
+{ s.branch(M_BLT, src1, src2, 0, label); }
 
-static void emit_bgti(char *src1, int imm, int label, ostream &s)
-{
-  s << BGT << src1 << " " << imm << " ";
-  emit_label_ref(label,s);
-  s << endl;
-}
+static void emit_blti(const char *src1, int imm, int label, MipsCode &s)
+{ s.branch(M_BLT, src1, NULL, imm, label); }
 
-static void emit_branch(int l, ostream& s)
-{
-  s << BRANCH;
-  emit_label_ref(l,s);
-  s << endl;
-}
+static void emit_bgti(const char *src1, int imm, int label, MipsCode &s)
+{ s.branch(M_BGT, src1, NULL, imm, label); }
 
-static void emit_branch(std::string const& l, ostream& s)
-{
-  s << BRANCH;
-  s << l;
-  s << endl;
-}
+static void emit_branch(int l, MipsCode& s)
+{ s.branch(M_B, NULL, NULL, 0, l); }
 
 //
 // Push a register on the stack. The stack grows towards smaller addresses.
 //
-static void emit_push(char *reg, ostream& str)
+static void emit_push(const char *reg, MipsCode& str)
 {
   emit_store(reg,0,SP,str);
   emit_addiu(SP,SP,-4,str);
@@ -359,56 +322,52 @@ static void emit_push(char *reg, ostream& str)
 // Emits code to fetch the integer value of the Integer object pointed
 // to by register source into the register dest
 //
-static void emit_fetch_int(char *dest, char *source, ostream& s)
+static void emit_fetch_int(const char *dest, const char *source, MipsCode& s)
 { emit_load(dest, DEFAULT_OBJFIELDS, source, s); }
 
 //
 // Emits code to store the integer value contained in register source
 // into the Integer object pointed to by dest.
 //
-static void emit_store_int(char *source, char *dest, ostream& s)
+static void emit_store_int(const char *source, const char *dest, MipsCode& s)
 { emit_store(source, DEFAULT_OBJFIELDS, dest, s); }
 
 
-static void emit_test_collector(ostream &s)
+static void emit_test_collector(MipsCode &s)
 {
   emit_push(ACC, s);
   emit_move(ACC, SP, s); // stack end
   emit_move(A1, ZERO, s); // allocate nothing
-  s << JAL << gc_collect_names[cgen_Memmgr] << endl;
+  emit_jal(gc_collect_names[cgen_Memmgr], s);
   emit_addiu(SP,SP,4,s);
   emit_load(ACC,0,SP,s);
 }
 
 
 
-static void emit_gc_check(char *source, ostream &s)
+static void emit_gc_check(const char *source, MipsCode &s)
 {
 	if (source != (char*)A1) emit_move(A1, source, s);
-	s << JAL << "_gc_check" << endl;
+	emit_jal("_gc_check", s);
 }
 
 
 /**
- * Generate unique label: base_label_ID (where ID is a 64 bit integer which progressively increases)
+ * Generate a unique label number, emitted as labelID by MipsCode::print.
  */
-static std::string generate_label(std::string const& base_label){
-	static unsigned long long label_count = 0;
-	std::stringstream ss;
-	ss<<base_label<<"_"<<label_count;
-	label_count++;
-	return ss.str();
+static int generate_label(){
+	return label_index++;
 }
 
-void emit_error_ifisvoid(char * error_fun, ostream &s)
+void emit_error_ifisvoid(const char *error_fun, MipsCode &s)
 {
-	auto isvoid_label = generate_label("isvoid_label");
-	auto exit_isvoid = generate_label("exit_isvoid");
+	auto isvoid_label = generate_label();
+	auto exit_isvoid = generate_label();
 
 	emit_beqz(ACC, isvoid_label, s);
 	emit_branch(exit_isvoid, s);
 	emit_label_def(isvoid_label, s);
-	s << LA << ACC << "\tstr_const0"<<endl;
+	emit_load_address(ACC, "str_const0", s);
 	emit_load_imm(T1, 1, s);
 	emit_jal(error_fun, s);
 	emit_label_def(exit_isvoid, s);
@@ -453,18 +412,18 @@ void StringEntry::code_def(ostream& s, int stringclasstag)
   IntEntryP lensym = inttable.add_int(len);
 
   // Add -1 eye catcher
-  s << WORD << "-1" << endl;
+  s << WORD << "-1\n";
 
   code_ref(s);  s  << LABEL                                             // label
-      << WORD << stringclasstag << endl                                 // tag
-      << WORD << (DEFAULT_OBJFIELDS + STRING_SLOTS + (len+4)/4) << endl // size
+      << WORD << stringclasstag << '\n'                                 // tag
+      << WORD << (DEFAULT_OBJFIELDS + STRING_SLOTS + (len+4)/4) << '\n' // size
       << WORD;
 
   emit_disptable_ref(Str, s);
 
  /***** Add dispatch information for class String ******/
-  s<<endl;
-      s << WORD;  lensym->code_ref(s);  s << endl;            // string length
+  s<< '\n';
+      s << WORD;  lensym->code_ref(s);  s << '\n';            // string length
   emit_string_constant(s,str);                                // ascii string
   s << ALIGN;                                                 // align to word
 }
@@ -496,17 +455,17 @@ void IntEntry::code_ref(ostream &s)
 void IntEntry::code_def(ostream &s, int intclasstag)
 {
   // Add -1 eye catcher
-  s << WORD << "-1" << endl;
+  s << WORD << "-1\n";
 
   code_ref(s);  s << LABEL                                // label
-      << WORD << intclasstag << endl                      // class tag
-      << WORD << (DEFAULT_OBJFIELDS + INT_SLOTS) << endl  // object size
+      << WORD << intclasstag << '\n'                      // class tag
+      << WORD << (DEFAULT_OBJFIELDS + INT_SLOTS) << '\n'  // object size
       << WORD; 
 
   emit_disptable_ref(Int, s);
  /***** Add dispatch information for class Int ******/
-  s<<endl;
-  s << WORD << str << endl;                           // integer value
+  s<< '\n';
+  s << WORD << str << '\n';                           // integer value
 }
 
 
@@ -520,6 +479,18 @@ void IntTable::code_string_table(ostream &s, int intclasstag)
 
   for (List<IntEntry> *l = tbl; l; l = l->tl())
     l->hd()->code_def(s,intclasstag);
+
+  // With -O, an Int object for every value from INT_CACHE_MIN to
+  // INT_CACHE_MAX, 20 bytes apart, with the one of 0 at int_cache.
+  if (!cgen_optimize) return;
+  for (int v = INT_CACHE_MIN; v <= INT_CACHE_MAX; v++){
+    s << WORD << "-1\n";
+    if (v == 0) s << INTCACHE << LABEL;
+    s << WORD << intclasstag << '\n'
+      << WORD << (DEFAULT_OBJFIELDS + INT_SLOTS) << '\n'
+      << WORD; emit_disptable_ref(Int, s); s << '\n';
+    s << WORD << v << '\n';
+  }
 }
 
 
@@ -541,18 +512,18 @@ void BoolConst::code_ref(ostream& s) const
 void BoolConst::code_def(ostream& s, int boolclasstag)
 {
   // Add -1 eye catcher
-  s << WORD << "-1" << endl;
+  s << WORD << "-1\n";
 
   code_ref(s);  s << LABEL                                  // label
-      << WORD << boolclasstag << endl                       // class tag
-      << WORD << (DEFAULT_OBJFIELDS + BOOL_SLOTS) << endl   // object size
+      << WORD << boolclasstag << '\n'                       // class tag
+      << WORD << (DEFAULT_OBJFIELDS + BOOL_SLOTS) << '\n'   // object size
       << WORD;
 
   emit_disptable_ref(Bool, s);
  /***** Add dispatch information for class Bool ******/
 
-      s << endl;                                            // dispatch table
-      s << WORD << val << endl;                             // value (0 or 1)
+      s << '\n';                                            // dispatch table
+      s << WORD << val << '\n';                             // value (0 or 1)
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -579,26 +550,34 @@ void CgenClassTable::code_global_data()
   //
   // The following global names must be defined first.
   //
-  str << GLOBAL << CLASSNAMETAB << endl;
-  str << GLOBAL; emit_protobj_ref(main,str);    str << endl;
-  str << GLOBAL; emit_protobj_ref(integer,str); str << endl;
-  str << GLOBAL; emit_protobj_ref(string,str);  str << endl;
-  str << GLOBAL; falsebool.code_ref(str);  str << endl;
-  str << GLOBAL; truebool.code_ref(str);   str << endl;
-  str << GLOBAL << INTTAG << endl;
-  str << GLOBAL << BOOLTAG << endl;
-  str << GLOBAL << STRINGTAG << endl;
+  str << GLOBAL << CLASSNAMETAB << '\n';
+  str << GLOBAL; emit_protobj_ref(main,str);    str << '\n';
+  str << GLOBAL; emit_protobj_ref(integer,str); str << '\n';
+  str << GLOBAL; emit_protobj_ref(string,str);  str << '\n';
+  str << GLOBAL; falsebool.code_ref(str);  str << '\n';
+  str << GLOBAL; truebool.code_ref(str);   str << '\n';
+  str << GLOBAL << INTTAG << '\n';
+  str << GLOBAL << BOOLTAG << '\n';
+  str << GLOBAL << STRINGTAG << '\n';
 
   //
   // We also need to know the tag of the Int, String, and Bool classes
   // during code generation.
   //
   str << INTTAG << LABEL
-      << WORD << intclasstag << endl;
+      << WORD << intclasstag << '\n';
   str << BOOLTAG << LABEL 
-      << WORD << boolclasstag << endl;
+      << WORD << boolclasstag << '\n';
   str << STRINGTAG << LABEL 
-      << WORD << stringclasstag << endl;    
+      << WORD << stringclasstag << '\n';    
+
+  // With -O and a collector, where the raw values in registers wait
+  // out a call into the runtime (see lower_save).
+  if (cgen_optimize && cgen_Memmgr != GC_NOGC){
+    str << RAWSAVE << LABEL;
+    for (int k = 0; k < RegAlloc::ncaller; k++)
+      str << WORD << 0 << '\n';
+  }
 }
 
 
@@ -611,21 +590,21 @@ void CgenClassTable::code_global_data()
 
 void CgenClassTable::code_global_text()
 {
-  str << GLOBAL << HEAP_START << endl
+  str << GLOBAL << HEAP_START << '\n'
       << HEAP_START << LABEL 
-      << WORD << 0 << endl
-      << "\t.text" << endl
+      << WORD << 0 << '\n'
+      << "\t.text\n"
       << GLOBAL;
   emit_init_ref(idtable.add_string("Main"), str);
-  str << endl << GLOBAL;
+  str << '\n' << GLOBAL;
   emit_init_ref(idtable.add_string("Int"),str);
-  str << endl << GLOBAL;
+  str << '\n' << GLOBAL;
   emit_init_ref(idtable.add_string("String"),str);
-  str << endl << GLOBAL;
+  str << '\n' << GLOBAL;
   emit_init_ref(idtable.add_string("Bool"),str);
-  str << endl << GLOBAL;
+  str << '\n' << GLOBAL;
   emit_method_ref(idtable.add_string("Main"), idtable.add_string("main"), str);
-  str << endl;
+  str << '\n';
 }
 
 void CgenClassTable::code_bools(int boolclasstag)
@@ -639,15 +618,15 @@ void CgenClassTable::code_select_gc()
   //
   // Generate GC choice constants (pointers to GC functions)
   //
-  str << GLOBAL << "_MemMgr_INITIALIZER" << endl;
-  str << "_MemMgr_INITIALIZER:" << endl;
-  str << WORD << gc_init_names[cgen_Memmgr] << endl;
-  str << GLOBAL << "_MemMgr_COLLECTOR" << endl;
-  str << "_MemMgr_COLLECTOR:" << endl;
-  str << WORD << gc_collect_names[cgen_Memmgr] << endl;
-  str << GLOBAL << "_MemMgr_TEST" << endl;
-  str << "_MemMgr_TEST:" << endl;
-  str << WORD << (cgen_Memmgr_Test == GC_TEST) << endl;
+  str << GLOBAL << "_MemMgr_INITIALIZER\n";
+  str << "_MemMgr_INITIALIZER:\n";
+  str << WORD << gc_init_names[cgen_Memmgr] << '\n';
+  str << GLOBAL << "_MemMgr_COLLECTOR\n";
+  str << "_MemMgr_COLLECTOR:\n";
+  str << WORD << gc_collect_names[cgen_Memmgr] << '\n';
+  str << GLOBAL << "_MemMgr_TEST\n";
+  str << "_MemMgr_TEST:\n";
+  str << WORD << (cgen_Memmgr_Test == GC_TEST) << '\n';
 }
 
 
@@ -719,15 +698,23 @@ void CgenClassTable::code_dispatchtables()
 	}
 }
 
-void CgenClassTable::fill_class_storages()
+void CgenClassTable::resolve(int *dispatches, int *devirtualized)
 {
-	List<CgenNode> *l = nds;
-	for (l; l != NULL; l = l->tl()){
-		Symbol className = l->hd()->get_name();
-		int n = 3;
-		auto &s = l->hd()->getStorage();
-		l->hd()->fill_storage_recursive(s, n);
+	ResolveContext ctx(Object);
+	root()->resolve(ctx, 3);
+	if (dispatches) *dispatches = ctx.dispatches;
+	if (devirtualized) *devirtualized = ctx.devirtualized;
+}
+
+int CgenClassTable::fold()
+{
+	FoldContext ctx;
+	for (List<CgenNode> *l = nds; l != NULL; l = l->tl()){
+		Features fs = l->hd()->features;
+		for (int i = fs->first(); fs->more(i); i = fs->next(i))
+			fs->nth(i)->fold(ctx);
 	}
+	return ctx.folded;
 }
 
 void CgenClassTable::code_objinitializers()
@@ -742,18 +729,9 @@ void CgenClassTable::code_objinitializers()
 
 void CgenClassTable::code_objmethods()
 {
-
-	for (auto l = nds; l != NULL; l = l->tl()){
-		Symbol className = l->hd()->get_name();
-		if (className == Str || className == IO || className==Object) continue;
-		l->hd()->count_temporaries(className);
-	}
-
 	for (auto l = nds; l != NULL; l = l->tl()){
 		Symbol className = l->hd()->get_name();
 		if (className == Str || className == IO || className==Object) continue;
-		dispatchTable[SELF_TYPE] = dispatchTable[className];
-		tempTable[SELF_TYPE] = tempTable[className];
 		l->hd()->code_methods(str);
 	}
 }
@@ -765,11 +743,15 @@ CgenClassTable::CgenClassTable(Classes classes, ostream& s) : nds(NULL) , str(s)
    stringclasstag = 4 /* Change to your String class tag here */;
 
    enterscope();
-   if (cgen_debug) cout << "Building CgenClassTable" << endl;
-   install_basic_classes();
-   install_classes(classes);
+   if (cgen_debug) cout << "Building CgenClassTable\n";
+   {
+     PhaseTimer t("build_inheritance_tree");
+     install_basic_classes();
+     install_classes(classes);
 
-   build_inheritance_tree();
+     build_inheritance_tree();
+     number_classes();
+   }
 
    code();
    exitscope();
@@ -956,6 +938,29 @@ void CgenClassTable::set_relations(CgenNodeP nd)
   parent_node->add_child(nd);
 }
 
+//
+// CgenClassTable::number_classes
+//
+// Renumbers the classes in preorder of the inheritance tree, so that the
+// tags of a class and its subclasses are the range tag() to last_tag().
+//
+void CgenClassTable::number_classes()
+{
+  int next = 0;
+  root()->number(next);
+  intclasstag = probe(Int)->tag();
+  boolclasstag = probe(Bool)->tag();
+  stringclasstag = probe(Str)->tag();
+}
+
+void CgenNode::number(int &next)
+{
+  classTag = next++;
+  for (List<CgenNode> *l = children; l; l = l->tl())
+    l->hd()->number(next);
+  lastTag = next - 1;
+}
+
 void CgenNode::add_child(CgenNodeP n)
 {
   children = new List<CgenNode>(n,children);
@@ -970,43 +975,60 @@ void CgenNode::set_parentnd(CgenNodeP p)
 
 void CgenClassTable::code()
 {
-  if (cgen_debug) cout << "coding global data" << endl;
-  code_global_data();
+  if (cgen_debug) cout << "coding global data\n";
+  { PhaseTimer t("code_global_data"); code_global_data(); }
 
-  if (cgen_debug) cout << "choosing gc" << endl;
-  code_select_gc();
+  if (cgen_debug) cout << "choosing gc\n";
+  { PhaseTimer t("code_select_gc"); code_select_gc(); }
 
-  if (cgen_debug) cout << "coding constants" << endl;
-  code_constants();
-
-  if (cgen_debug) cout<<" coding class_nameTab"<<endl;
+  if (cgen_debug) cout<<" coding class_nameTab\n";
+  { PhaseTimer t("code_classnametab");
   code_classnametab("class_nameTab", [](Symbol className, ostream& str){
 	  str<<WORD;
 	  stringtable.lookup_string(className->get_string())->code_ref(str);
-	  str<<endl;;});
+	  str<< '\n';;}); }
 
-  if (cgen_debug) cout<<" coding objectTab"<<endl;
+  if (cgen_debug) cout<<" coding objectTab\n";
+  { PhaseTimer t("code_objtab");
   code_classnametab("object_Tab", [](Symbol className, ostream& str){
-	  str<<WORD; str<<className->get_string()<<"_protObj"<<endl;
-	  str<<WORD; str<<className->get_string()<<"_init" <<endl;
-  });
-
-  if (cgen_debug) cout<<" coding dispatch tables"<<endl;
-  code_dispatchtables();
+	  str<<WORD; str<<className->get_string()<<"_protObj\n";
+	  str<<WORD; str<<className->get_string()<<"_init\n";
+  }); }
+
+  if (cgen_debug) cout<<" coding dispatch tables\n";
+  { PhaseTimer t("code_dispatchtables"); code_dispatchtables(); }
+
+  // The resolve pass looks up the slots the dispatch tables fill in,
+  // and folding adds constants, so the constants come after both.
+  int dispatches, devirtualized;
+  if (cgen_debug) cout << "resolving names\n";
+  { PhaseTimer t("resolve"); resolve(&dispatches, &devirtualized); }
+
+  if (cgen_optimize){
+    if (cgen_debug) cout << "folding constants\n";
+    PhaseTimer t("fold");
+    int n = fold();
+    str << "# folded " << n << " constant expressions\n";
+    if (n > 0) resolve(&dispatches, &devirtualized);
+    str << "# devirtualized " << devirtualized << " of " << dispatches << " dynamic dispatches";
+    if (dispatches) str << " (" << 100 * devirtualized / dispatches << "%)";
+    str << "\n";
+  }
 
-  if (cgen_debug) cout<<" coding prototypes"<<endl;
-  code_prototypes();
+  if (cgen_debug) cout << "coding constants\n";
+  { PhaseTimer t("code_constants"); code_constants(); }
 
-  if (cgen_debug) cout << "coding global text" << endl;
-  code_global_text();
+  if (cgen_debug) cout<<" coding prototypes\n";
+  { PhaseTimer t("code_prototypes"); code_prototypes(); }
 
-  fill_class_storages();
+  if (cgen_debug) cout << "coding global text\n";
+  { PhaseTimer t("code_global_text"); code_global_text(); }
 
-  if (cgen_debug) cout << "coding object initialisers" << endl;
-  code_objinitializers();
+  if (cgen_debug) cout << "coding object initialisers\n";
+  { PhaseTimer t("code_objinitializers"); code_objinitializers(); }
 
-  if (cgen_debug) cout << "coding object methods" << endl;
-  code_objmethods();
+  if (cgen_debug) cout << "coding object methods\n";
+  { PhaseTimer t("code_objmethods"); code_objmethods(); }
 }
 
 CgenNodeP CgenClassTable::root()
@@ -1025,21 +1047,23 @@ CgenNode::CgenNode(Class_ nd, Basicness bstatus, int classTag, CgenClassTableP c
    parentnd(NULL),
    children(NULL),
    basic_status(bstatus),
-   classTag(classTag)
+   classTag(classTag),
+   lastTag(classTag)
 {
 
    stringtable.add_string(name->get_string());          // Add class name to string table
 }
 
 
-void CgenNode::initialize_attributes(ostream& ss)
+// unread: no initializer before these attributes can read self.
+void CgenNode::initialize_attributes(ostream& ss, bool& unread)
 {
 	if (get_parent()!=No_class){
-		get_parentnd()->initialize_attributes(ss);
+		get_parentnd()->initialize_attributes(ss, unread);
 	}
 
 	for (int i = features->first(); features->more(i); i = features->next(i)){
-		features->nth(i)->initialize_attribute(ss);
+		features->nth(i)->initialize_attribute(ss, unread);
 	}
 }
 
@@ -1060,13 +1084,14 @@ int CgenNode::getNumAttributes(){
 void CgenNode::code_prototype(ostream& ss)
 {
 	int nAttrs = getNumAttributes();
-	ss << WORD << -1 << endl;
+	ss << WORD << -1 << '\n';
 	emit_protobj_ref(name, ss);	ss<<LABEL;
 
-	ss << WORD << tag()<<endl;
-	ss << WORD << nAttrs+3<<endl;
-	ss << WORD;	emit_disptable_ref(name, ss); ss<<endl;
-	initialize_attributes(ss);
+	ss << WORD << tag()<< '\n';
+	ss << WORD << nAttrs+3<< '\n';
+	ss << WORD;	emit_disptable_ref(name, ss); ss<< '\n';
+	bool unread = true;
+	initialize_attributes(ss, unread);
 }
 
 void CgenNode::code_dispatchtable(std::map<Symbol, Symbol>& methodList, Symbol classname, ostream& ss)
@@ -1085,88 +1110,177 @@ void CgenNode::code_dispatchtable(std::map<Symbol, Symbol>& methodList, Symbol c
 	}
 }
 
-void CgenNode::fill_storage_recursive(Storage& s, int& n){
+void CgenNode::code_init_recursive(ostream& ss, int& n)
+{
 	if (get_parent() != No_class){
-		get_parentnd()->fill_storage_recursive(s, n);
+		get_parentnd()->code_init_recursive(ss, n);
 	}
 
-	for (int i = features->first(); features->more(i); i = features->next(i)){
-		features->nth(i)->fill_storage(s, n);
-	}
+
 }
 
-int CgenNode::init_temporaries_recursive(){
-	int t = 0;
+void CgenNode::code_methods(ostream& ss)
+{
 	for (int i = features->first(); features->more(i); i = features->next(i)){
-		t += features->nth(i)->init_temps();
+		features->nth(i)->code_method(name, ss);
 	}
+}
 
-	if (get_parent() != No_class){
-		t += get_parentnd()->init_temporaries_recursive();
-	}
 
-	return t;
+//
+// With -O an object of a known, small size is allocated the way the
+// runtime's allocator does it, by bumping $gp, and filled in from its
+// protObj with unrolled loads and stores.  When that would pass the
+// limit in $s7, Object.copy runs the collector.  The first words of the
+// copy are all the caller needs: an Int that is stored into at once only
+// wants the header.
+//
+#define INLINE_NEW_WORDS 16
+
+static void emit_new(Symbol type, MipsCode &s, int words = -1)
+{
+	int size = classTable[type]->getNumAttributes() + DEFAULT_OBJFIELDS;
+	if (!cgen_optimize || size > INLINE_NEW_WORDS){
+		emit_load_protobj(ACC, type, s);
+		emit_jal("Object.copy", s);
+		return;
+	}
+	if (words < 0 || words > size) words = size;
+
+	int slow = generate_label(), done = generate_label();
+	emit_addiu(T2, GP, WORD_SIZE * (size + 1), s);
+	emit_cmp(M_BGT, T2, LIMIT, slow, s);
+	emit_addiu(ACC, GP, WORD_SIZE, s);
+	emit_move(GP, T2, s);
+	emit_load_imm(T1, -1, s);               // the eyecatcher
+	emit_store(T1, -1, ACC, s);
+	emit_load_protobj(T3, type, s);
+	for (int k = 0; k < words; k++){
+		emit_load(T1, k, T3, s);
+		emit_store(T1, k, ACC, s);
+	}
+	emit_branch(done, s);
 
+	emit_label_def(slow, s);
+	emit_load_protobj(ACC, type, s);
+	emit_jal("Object.copy", s);
+	emit_label_def(done, s);
+}
 
+//
+// Ints are never changed in place, so under -O an Int value from
+// INT_CACHE_MIN to INT_CACHE_MAX is boxed by taking its preallocated
+// object, at int_cache + 20 * value, into $a0.  Other values branch to
+// alloc.  Clobbers $t2 and $t3.
+//
+static void emit_int_cache(const char *src, int alloc, MipsCode &s)
+{
+	emit_blti(src, INT_CACHE_MIN, alloc, s);
+	emit_bgti(src, INT_CACHE_MAX, alloc, s);
+	emit_sll(T2, src, 2, s);
+	emit_sll(T3, src, 4, s);
+	emit_addu(T2, T2, T3, s);
+	emit_load_address(ACC, INTCACHE, s);
+	emit_addu(ACC, ACC, T2, s);
 }
 
-void CgenNode::code_init_recursive(ostream& ss, int& n)
+// Boxes the Int value in $t1 into $a0.
+static void emit_box_int(MipsCode &s)
 {
-	if (get_parent() != No_class){
-		get_parentnd()->code_init_recursive(ss, n);
+	int done = -1;
+	if (cgen_optimize){
+		int alloc = generate_label();
+		done = generate_label();
+		emit_int_cache(T1, alloc, s);
+		emit_branch(done, s);
+		emit_label_def(alloc, s);
 	}
 
+	emit_store(T1, 0, SP, s);
+	emit_addiu(SP, SP, -4, s);
 
+	emit_new(Int, s, DEFAULT_OBJFIELDS);
+
+	emit_load(T1, 1, SP, s);
+	emit_addiu(SP, SP, 4, s);
+	emit_store(T1, 3, ACC, s);
+	if (done >= 0) emit_label_def(done, s);
 }
 
-void CgenNode::count_temporaries(Symbol className)
+static bool is_literal(Expression e)
 {
-	if (get_parent() != No_class){
-		get_parentnd()->count_temporaries(className);
-	}
+	return dynamic_cast<int_const_class *>(e) || dynamic_cast<bool_const_class *>(e) ||
+		dynamic_cast<string_const_class *>(e);
+}
 
-	for (int i = features->first(); features->more(i); i = features->next(i)){
-		features->nth(i)->count_temporaries(tempTable[className]);
-	}
+// Whether the generational collector must hear of a store of the value
+// of e to an attribute.  Constants and void are not in the heap.  The
+// stack machine follows the rules of IrFunction::elide_write_barriers:
+// this one, and that an object is young until the first call after its
+// allocation, which it only knows of self at the start of a flattened
+// Class_init (see init_flat_attr).
+static bool needs_write_barrier(Expression e)
+{
+	return cgen_Memmgr == GC_GENGC && !is_literal(e) && !dynamic_cast<no_expr_class *>(e);
 }
 
-void CgenNode::code_methods(ostream& ss)
+// Initializers whose code calls nothing, and so cannot run the collector.
+static bool calls_nothing(Expression e)
 {
-	for (int i = features->first(); features->more(i); i = features->next(i)){
-		features->nth(i)->code_method(name, storage,  ss);
-	}
+	return is_literal(e) || dynamic_cast<object_class *>(e) || dynamic_cast<no_expr_class *>(e);
+}
+
+// Whether the attribute is initialized in Class_init, with -O only.
+// Valid once the prototypes are coded.
+bool attr_class::has_init()
+{
+	return init->type && init->type != No_type && !in_prototype;
 }
 
+// Initializers that cannot assign to an attribute of self.
+static bool assigns_nothing(Expression e)
+{
+	return is_literal(e) || dynamic_cast<new__class *>(e) || dynamic_cast<object_class *>(e);
+}
 
-void emit_new(Symbol type, ostream &s)
+// Initializers that cannot read an attribute of self, so the ones after
+// them may already hold their value.
+static bool reads_nothing(Expression e)
 {
-	s<<LA<<ACC<<" ";
-	emit_protobj_ref(type, s);
-	s<<endl;
-	s<<JAL<<"Object.copy"<<endl;
+	return is_literal(e) || dynamic_cast<new__class *>(e) || dynamic_cast<no_expr_class *>(e);
 }
 
-void attr_class::init_single_attr(Storage& storage,  ostream& ss,  int& n)
+void attr_class::init_flat_attr(MipsCode& ss, Symbol cls, bool& dirty, bool& young)
 {
+	int offset = loc->offset;
+
+	if (has_init()){
+		init->code(ss);
+		if (!calls_nothing(init)) young = false;
+		emit_store(ACC, offset, SELF, ss);
+		if (!young && needs_write_barrier(init)) emit_write_barrier(SELF, offset, ss);
+		if (!assigns_nothing(init)) dirty = true;
+	} else if (dirty){
+		emit_load_protobj(T1, cls, ss);
+		emit_load(ACC, offset, T1, ss);
+		emit_store(ACC, offset, SELF, ss);
+	}
+}
 
-	int offset = storage[name]->offset;
+void attr_class::init_single_attr(MipsCode& ss)
+{
+	int offset = loc->offset;
 
-	if (!init->type &&
+	if ((!init->type || init->type == No_type) &&
 			(type_decl == Str || type_decl == Int || type_decl == Bool)){
 		emit_new(type_decl, ss);
 		emit_store(ACC, offset, SELF, ss);
+		if (cgen_Memmgr == GC_GENGC) emit_write_barrier(SELF, offset, ss);
 	} else {
-		init->code(storage, ss);
+		init->code(ss);
 		emit_store (ACC, offset, SELF , ss);
+		if (needs_write_barrier(init)) emit_write_barrier(SELF, offset, ss);
 	}
-
-	n++;
-}
-
-void attr_class::fill_storage(Storage& storage, int& n)
-{
-	storage[name] = new StorageInfo(SELF, n);
-	n++;
 }
 
 void method_class::code_dispatchtableentry(std::map<Symbol, Symbol>& methodList,
@@ -1178,12 +1292,16 @@ void method_class::code_dispatchtableentry(std::map<Symbol, Symbol>& methodList,
 		emit_method_ref(methodList[name], name, ss);
 		dispatchTable[name] = k;
 		methodList.erase(name);
-		ss<<endl;
+		ss<< '\n';
 		k++;
 	}
 }
 
-static void emit_function_header(ostream &ss)
+//
+// Saves the registers of the caller and allocates `slots' words of frame
+// below them, addressed as -1($fp), -2($fp), ...
+//
+static void emit_function_header(MipsCode &ss, int slots)
 {
 
 	emit_store(FP, 0, SP, ss);
@@ -1199,43 +1317,51 @@ static void emit_function_header(ostream &ss)
 	// Fix the frame pointer
 	emit_move(FP, SP, ss);
 
-	// Increase the sp
-	emit_addiu(SP, SP, -4, ss);
-
+	// Increase the sp past the saved registers and the frame slots
+	emit_addiu(SP, SP, -4*(1 + slots), ss);
 }
 
-static void emit_function_trailer(ostream &ss, int n)
+static void emit_function_trailer(MipsCode &ss, int n, int slots)
 {
 	// Load the return address
 	emit_load(RA, 0, FP, ss);
 	emit_load(SELF, 1, FP, ss);
 	emit_load(FP, 2, FP, ss);
 
-	// Restore the stack (n arguments + fp + ra + self)
-	emit_addiu(SP, SP, 4*n, ss);
+	// Restore the stack (n arguments + fp + ra + self, and the frame)
+	emit_addiu(SP, SP, 4*(n + slots), ss);
 
 	// Return
 	emit_return(ss);
 }
 
-void method_class::code_method(Symbol className, Storage & storage, ostream& s)
+static void build_method(method_class *m, IrFunction &f, bool inline_calls = true);
+static void lower_function(IrFunction &f, MipsCode &s, ostream &out);
+
+//
+// With -O the body goes through the IR (see ir.h), otherwise it is
+// coded by the stack machine.
+//
+void method_class::code_method(Symbol className, ostream& out)
 {
-	emit_method_ref(className, name, s); s<<LABEL;
+	emit_method_ref(className, name, out); out<<LABEL;
 
-	emit_function_header(s);
+	MipsCode s;
+	if (cgen_optimize){
+		IrFunction f(className, name, formals->len());
+		build_method(this, f);
+		lower_function(f, s, out);
+		s.optimize();
+		s.print(out); out<< '\n';
+		return;
+	}
 
-	Storage storage2 = storage;
-	int n = 3;
+	emit_function_header(s, frame_slots);
 
-	for (int i = formals->first(); formals->more(i); i = formals->next(i)){
-		Symbol parameter = formals->nth(i)->get_name();
-		storage2[parameter] = new StorageInfo(FP, n);
-		n++;
-	}
-	storage2[self] = new StorageInfo(FP, n);
+	int n = 3 + formals->len();
 
 	emit_load(SELF, n, FP, s);
-	expr->code(storage2, s);
+	expr->code(s);
 
 	if (expr->type == Int){
 		emit_load(T1, 3, ACC, s);
@@ -1247,123 +1373,159 @@ void method_class::code_method(Symbol className, Storage & storage, ostream& s)
 		emit_addiu(SP, SP, 4, s);
 		emit_store(T1, 3, ACC, s);
 	}
-	emit_function_trailer(s,n); s<<endl;
+	emit_function_trailer(s, n, frame_slots);
+
+	s.optimize();
+	s.print(out); out<< '\n';
 }
 
-void dispatch_class::code(Storage &storage,  ostream &s) {
+void dispatch_class::code(MipsCode &s) {
 	emit_comment("dispatch_class", s);
 	int N = actual->len();
-	int temps = tempTable[expr->type][name];
-
-	Storage storage2 = storage;
-
-	emit_addiu(SP, SP, -4*temps, s);
 
 	// Push the parameters onto the stack
 	size_t pars = 1;
 	emit_addiu(SP, SP, -4*actual->len() -4, s);
 
 	for (int i = actual->first(); actual->more(i); i = actual->next(i)){
-		actual->nth(i)->code(storage2, s);
+		actual->nth(i)->code(s);
 		emit_store(ACC, pars, SP, s);
 		pars++;
 	}
 
-	expr->code(storage2, s);
+	expr->code(s);
 	emit_error_ifisvoid("_dispatch_abort", s);
 	emit_store(ACC, pars, SP, s);
 
-	int offset = dispatchTable[expr->type][name];
+	int offset = slot;
 	emit_load(ACC, pars, SP, s);
-	emit_load(T1, DISPTABLE_OFFSET, ACC, s);
-	emit_load(T2, offset, T1, s);
-	emit_jalr(T2, s);
+	if (target){
+		emit_jal_method(target, name, s);
+	} else {
+		emit_load(T1, DISPTABLE_OFFSET, ACC, s);
+		emit_load(T2, offset, T1, s);
+		emit_jalr(T2, s);
+	}
 
 
 	emit_addiu(SP, SP, 4, s);
-	emit_addiu(SP, SP, 4*(temps), s);
 }
 
-void static_dispatch_class::code(Storage &storage,ostream &s) {
+void static_dispatch_class::code(MipsCode &s) {
 		emit_comment("static_dispatch_class", s);
 		int N = actual->len();
-		int temps = tempTable[expr->type][name];
-
-		Storage storage2 = storage;
-
-		emit_addiu(SP, SP, -4*temps, s);
 
 		// Push the parameters onto the stack
 		size_t pars = 1;
 		emit_addiu(SP, SP, -4*actual->len() -4, s);
 
 		for (int i = actual->first(); actual->more(i); i = actual->next(i)){
-			actual->nth(i)->code(storage2, s);
+			actual->nth(i)->code(s);
 			emit_store(ACC, pars, SP, s);
 			pars++;
 		}
 
-		expr->code(storage2, s);
+		expr->code(s);
 		emit_error_ifisvoid("_dispatch_abort", s);
 		emit_store(ACC, pars, SP, s);
 
-		int offset = dispatchTable[type_name][name];
-		std::stringstream ss;
-		s << LA << T1<<"\t"<< type_name->get_string() <<"_protObj"<<std::endl;;
-		emit_load(T1, DISPTABLE_OFFSET, T1, s);
-		emit_load(T2, offset, T1, s);
-		emit_jalr(T2, s);
+		int offset = slot;
+		if (target){
+			emit_jal_method(target, name, s);
+		} else {
+			emit_load_protobj(T1, type_name, s);
+			emit_load(T1, DISPTABLE_OFFSET, T1, s);
+			emit_load(T2, offset, T1, s);
+			emit_jalr(T2, s);
+		}
 
 
 		emit_addiu(SP, SP, 4, s);
-		emit_addiu(SP, SP, 4*(temps), s);
 }
 
 
 
-void CgenNode::code_init(ostream& ss)
+//
+// With -O, Class_init runs the initializers of all the ancestors itself
+// instead of calling the parent's Class_init, and skips the attributes
+// declared without one, whose defaults are already in the prototype.
+// Once an initializer that might assign another attribute has run, the
+// later defaults are copied from the prototype again.  A class none of
+// whose attributes has an initializer needs no Class_init at all: new
+// does not call it, and the one in object_Tab just returns.
+//
+void CgenNode::code_init(ostream& out)
 {
-	int init_temps = init_temporaries_recursive();
-
-	emit_addiu(SP, SP, -4*(init_temps+1), ss);
-	emit_store(SELF, 1, SP, ss);
+	MipsCode ss;
+	if (cgen_optimize && !has_init()){
+		emit_return(ss);
+	} else if (cgen_optimize){
+		// new calls Class_init straight after allocating self, so self
+		// is young until an initializer calls something.
+		int slots = flat_init_slots();
+		bool dirty = false, young = true;
+		emit_function_header(ss, slots);
+		emit_store(SELF, -1, FP, ss);
+		code_flat_init(ss, dirty, young);
+		emit_function_trailer(ss, 3, slots);
+	} else {
+		emit_function_header(ss, init_slots);
+		emit_store(SELF, -1, FP, ss);
 
-	emit_function_header(ss);
+		if (parent != No_class) emit_jal_init(get_parent(), ss);
 
-	if (parent != No_class) ss<<JAL<< get_parent()->get_string()<<"_init"<<endl;;
+		for (int i = features->first(); features->more(i); i = features->next(i)){
+			features->nth(i)->init_single_attr(ss);
+		}
 
+		emit_function_trailer(ss, 3, init_slots);
+	}
 
-    int n = 3;
+	ss.optimize();
+	ss.print(out);
+}
 
-    for (int i = features->first(); features->more(i); i = features->next(i)){
-    	storage[self] = new StorageInfo(FP, 3);
-    	dispatchTable[SELF_TYPE] = dispatchTable[this->name];
-    	features->nth(i)->init_single_attr(storage, ss, n);
-    }
+void CgenNode::code_flat_init(MipsCode& ss, bool& dirty, bool& young)
+{
+	if (get_parent() != No_class) get_parentnd()->code_flat_init(ss, dirty, young);
+	for (int i = features->first(); features->more(i); i = features->next(i))
+		features->nth(i)->init_flat_attr(ss, name, dirty, young);
+}
 
-	emit_addiu(SP, SP, 4*(init_temps+1), ss);
-	emit_function_trailer(ss, 3);
+// Whether this class or an ancestor has an attribute with an initializer.
+bool CgenNode::has_init()
+{
+	for (int i = features->first(); features->more(i); i = features->next(i))
+		if (features->nth(i)->has_init()) return true;
+	return get_parent() != No_class && get_parentnd()->has_init();
+}
 
+int CgenNode::flat_init_slots()
+{
+	int parent_slots = get_parent() != No_class ? get_parentnd()->flat_init_slots() : 0;
+	return std::max(init_slots, parent_slots);
 }
 
-void new__class::code(Storage &storage,ostream &s)
+void new__class::code(MipsCode &s)
 {
 	emit_comment("new sequence", s);
 
+	// With -O a class with nothing to initialize has no Class_init.
+	if (type_name != SELF_TYPE && cgen_optimize && !classTable[type_name]->has_init()){
+		emit_new(type_name, s);
+		return;
+	}
+
 	if (type_name != SELF_TYPE){
-		s<<LA<<ACC<<" ";
-		emit_protobj_ref(this->type_name, s);
-		s<<endl;
+		emit_load_protobj(ACC, type_name, s);
 	} else {
 		emit_load(T1, TAG_OFFSET, SELF, s);
-		emit_load_imm(T3, 8, s);
-		emit_mul(T1, T1, T3, s);
-
+		emit_sll(T1, T1, 3, s);
 		emit_load_address(T2, "object_Tab", s);
 		emit_addu(T2, T1, T2, s);
 		emit_load(ACC, 0, T2, s);
 	}
-	s<<JAL<< "Object"<< METHOD_SEP<<"copy"<<endl;;
+	emit_jal("Object.copy", s);
 
 	emit_store(ACC, 0, SP, s);
 	emit_addiu(SP, SP, -4, s);
@@ -1373,15 +1535,13 @@ void new__class::code(Storage &storage,ostream &s)
 
 	emit_move(SELF, ACC, s);
 	if (type_name != SELF_TYPE){
-		s<<JAL<< type_name->get_string()<<CLASSINIT_SUFFIX<<endl;
+		emit_jal_init(type_name, s);
 	} else {
 		emit_load(T1, TAG_OFFSET, SELF, s);
-		emit_load_imm(T3, 8, s);
-		emit_mul(T1, T1, T3, s);
-		emit_addiu(T1, T1, 4, s);
+		emit_sll(T1, T1, 3, s);
 		emit_load_address(T2, "object_Tab", s);
 		emit_addu(T2, T1, T2, s);
-		emit_load(T2, 0, T2, s);
+		emit_load(T2, 1, T2, s);
 		emit_jalr(T2, s);
 
 	}
@@ -1395,22 +1555,48 @@ void new__class::code(Storage &storage,ostream &s)
 
 }
 
-void attr_class::initialize_attribute(ostream& ss)
+// Writes the reference to the constant object of e, if it is a literal.
+static bool code_constant_ref(Expression e, ostream& s)
+{
+	if (int_const_class *i = dynamic_cast<int_const_class *>(e))
+		inttable.lookup_string(i->token->get_string())->code_ref(s);
+	else if (string_const_class *str = dynamic_cast<string_const_class *>(e))
+		stringtable.lookup_string(str->token->get_string())->code_ref(s);
+	else if (bool_const_class *b = dynamic_cast<bool_const_class *>(e))
+		(b->val ? truebool : falsebool).code_ref(s);
+	else
+		return false;
+	return true;
+}
+
+//
+// The prototype holds the defaults, and with -O the value of an
+// initializer that is a constant, after folding, as long as no earlier
+// initializer in the class chain can read self and see it too soon;
+// Class_init then skips the attribute.
+//
+void attr_class::initialize_attribute(ostream& ss, bool& unread)
 {
+	static StringEntryP emptyString = stringtable.lookup_string("");
+	static IntEntryP zero = inttable.lookup_string("0");
+
+	in_prototype = cgen_optimize && unread && is_literal(init);
+	if (!reads_nothing(init)) unread = false;
+
 	ss<<WORD;
-	if (type_decl==Str){
-		StringEntryP emptyString = stringtable.lookup_string("");
+	if (in_prototype && code_constant_ref(init, ss)){
+		ss<< '\n';
+	} else if (type_decl==Str){
 		emptyString->code_ref(ss);
-		ss<<endl;
+		ss<< '\n';
 	} else if (type_decl==Int){
-		IntEntryP zero = inttable.lookup_string("0");
 		zero->code_ref(ss);
-		ss<<endl;
+		ss<< '\n';
 	} else if (type_decl==Bool){
 		falsebool.code_ref(ss);
-		ss<<endl;
+		ss<< '\n';
 	} else {
-		ss<<0<<endl;;
+		ss<<0<< '\n';;
 	}
 }
 
@@ -1422,150 +1608,479 @@ void method_class::override(std::map<Symbol, Symbol> & methodList, Symbol classn
 
 //******************************************************************
 //
-//   Fill in the following methods to produce code for the
-//   appropriate expression.  You may add or remove parameters
-//   as you wish, but if you do, remember to change the parameters
-//   of the declarations in `cool-tree.h'  Sample code for
-//   constant integers, strings, and booleans are provided.
+//   Resolve pass
+//
+//   Run over every method body and attribute initializer before any
+//   of them is coded.  Object references are bound to their StorageInfo
+//   and dispatches to their dispatch table slot, so that code() can
+//   read both straight off the node.
+//
+//   The pass also lays out the frames.  Every node that binds, reads or
+//   writes a let/case variable advances a clock, so a binding lives from
+//   the point it is stored to the last point it is used.  A variable
+//   used inside a loop it was bound outside of stays live to the end of
+//   the loop.  end_frame() colors these intervals by linear scan, so the
+//   frame has as many slots as there are bindings live at once, and
+//   each binding gets the slot `base - color'.
+//
+//   Formals, self and attributes have fixed locations, shared by every
+//   node that uses them through pools indexed by offset.
 //
 //*****************************************************************
 
-int getNextTemp(Storage s){
-	int t = 0;
-	for (auto const& it : s){
-		auto reg = std::string(it.second->reg);
-		auto fp = std::string(FP);
-		if (reg==fp){ t++; }
-	}
-	return t;
+static StorageInfo *frame_slot(int offset)
+{
+	static std::map<int, StorageInfo *> pool;
+	StorageInfo *&info = pool[offset];
+	if (info == NULL) info = new StorageInfo(FP, offset);
+	return info;
 }
 
-void typcase_class::code(Storage &storage,ostream &s) {
-	Storage storage2 = storage;
-
-	std::map<int, bool> tags;
-	Symbol typeC = expr->type;
-	for (auto c : classTable){
-		tags[c.second->tag()] = true;
-	}
-
-	std::map<int, std::string> case_label;
-	for (auto t : tags){
-		std::stringstream ss;
-		ss << "case_"<<t.first;
-		case_label[t.first] = generate_label(ss.str());
+static StorageInfo *attr_slot(int offset)
+{
+	static std::vector<StorageInfo *> pool;
+	if ((int) pool.size() <= offset) pool.resize(offset + 1, NULL);
+	if (pool[offset] == NULL){
+		pool[offset] = new StorageInfo(SELF, offset);
+		pool[offset]->attribute = true;
 	}
-	auto end_typcase = generate_label("end_typcase");
+	return pool[offset];
+}
 
-	expr->code(storage2, s);
-	emit_move(T2, ACC, s);
-	emit_error_ifisvoid("_case_abort2", s);
+// Let/case bindings get their offset once their frame is colored.
+static StorageInfo *new_local(int index)
+{
+	static std::deque<StorageInfo> pool;
+	pool.push_back(StorageInfo(FP, 0, index));
+	return &pool.back();
+}
 
-	// T1 now stores the expression tag
-	emit_load(T1, TAG_OFFSET, ACC, s);
-	for (auto t : tags){
-		emit_load_imm(T3, t.first, s);
-		emit_beq(T1, T3, case_label[t.first] , s);
-	}
+void ResolveContext::begin_frame(int b)
+{
+	base = b;
+	clock = 0;
+	locals.clear();
+	scope.clear();
+}
 
-	for (int i = cases->first(); cases->more(i); i = cases->next(i)){
-		Symbol id = cases->nth(i)->get_id();
-		Symbol type = cases->nth(i)->get_type();
+int ResolveContext::end_frame()
+{
+	// Locals are created in order of their start point.
+	typedef std::pair<int, int> Active;    // end point, color
+	std::priority_queue<Active, std::vector<Active>, std::greater<Active> > active;
+	std::priority_queue<int, std::vector<int>, std::greater<int> > free_colors;
+	int colors = 0;
 
-		auto t = classTable[type]->tag();
-		if (case_label.find(t) != case_label.end()){
-			emit_label_def(case_label[t], s);
-			tags[t] = false;
+	for (auto const& l : locals){
+		while (!active.empty() && active.top().first < l.start){
+			free_colors.push(active.top().second);
+			active.pop();
 		}
-		int t_pos = 3 + getNextTemp(storage2);
-		storage2[id] = new StorageInfo(FP, t_pos);
-		emit_store(T2, storage2[id]->offset, FP, s);
-
-		cases->nth(i)->code(storage2, s);
-		emit_branch(end_typcase, s);
-
-	}
-	for (auto t : tags){
-		if (t.second){
-			emit_label_def(case_label[t.first], s);
-			emit_jal("_case_abort", s); // runtime abort
+		int color;
+		if (free_colors.empty()){
+			color = colors++;
+		} else {
+			color = free_colors.top();
+			free_colors.pop();
 		}
+		l.info->offset = base - color;
+		active.push(Active(l.end, color));
 	}
-
-	emit_label_def(end_typcase, s);
+	return colors;
 }
 
-void block_class::code(Storage &storage,ostream &s) {
-	Storage storage2 = storage;
-	for (int i = body->first(); body->more(i); i = body->next(i)){
-		body->nth(i)->code(storage2, s);
-	}
+StorageInfo *ResolveContext::bind(Symbol name)
+{
+	FrameLocal l;
+	l.info = new_local(locals.size());
+	l.start = l.end = clock++;
+	scope.push_back(locals.size());
+	locals.push_back(l);
+
+	env.enterscope();
+	env.addid(name, l.info);
+	return l.info;
 }
 
-void assign_class::code(Storage &storage, ostream &s) {
-	emit_comment("assign_class", s);
-	Storage storage2 = storage;
-	expr->code(storage2, s);
-	emit_store(ACC, storage2[name]->offset, storage2[name]->reg, s);
+void ResolveContext::unbind()
+{
+	env.exitscope();
+	scope.pop_back();
 }
 
+void ResolveContext::use(StorageInfo *info)
+{
+	if (info != NULL && info->local >= 0)
+		locals[info->local].end = clock;
+	clock++;
+}
 
-void cond_class::code(Storage &storage,  ostream &s) {
-	auto cond_else = generate_label("cond_else");
-	auto cond_exit = generate_label("cond_exit");
+void ResolveContext::end_loop(int start)
+{
+	for (int i : scope){
+		FrameLocal &l = locals[i];
+		if (l.start < start && l.end >= start) l.end = clock;
+	}
+	clock++;
+}
 
-	Storage storage2 = storage;
-	pred->code(storage2, s);
-	emit_load(T1, BOOL_SLOTS, ACC, s);
-	emit_beqz(T1, cond_else, s);
-	then_exp->code(storage, s);
-	emit_branch(cond_exit, s);
-	emit_label_def(cond_else, s);
-	else_exp->code(storage, s);
-	emit_label_def(cond_exit, s);
+static void resolve_list(Expressions l, ResolveContext &ctx)
+{
+	for (int i = l->first(); l->more(i); i = l->next(i))
+		l->nth(i)->resolve(ctx);
 }
 
-void loop_class::code(Storage &storage,ostream &s) {
-	auto loop_start = generate_label("loop_start");
-	auto loop_end = generate_label("loop_end");
+void attr_class::bind_attribute(ResolveContext &ctx, int& n)
+{
+	loc = attr_slot(n++);
+	ctx.env.addid(name, loc);
+}
 
-	Storage storage2 = storage;
-	emit_label_def(loop_start, s);
-	pred->code(storage2, s);
-	emit_load(T1, BOOL_SLOTS, ACC, s);
-	emit_beqz(T1, loop_end, s);
-	Storage storage3 = storage;
-	body->code(storage3, s);
-	emit_branch(loop_start, s);
-	emit_label_def(loop_end, s);
-	emit_load_imm(ACC, 0, s);
+void attr_class::resolve_init(ResolveContext &ctx)
+{
+	init->resolve(ctx);
 }
 
-void let_class::code(Storage &storage,ostream &s) {
-	emit_comment("let_class", s);
-	Storage storage2 = storage;
+// Formals are at 3($fp) upwards, pushed by the caller, with self above
+// them; the let/case slots are below the saved registers.
+void method_class::resolve(ResolveContext &ctx)
+{
+	int n = 3;
 
-	if (!init->type &&
-				(type_decl == Str || type_decl == Int || type_decl == Bool)){
-		emit_new(type_decl, s);
-	} else {
-		init->code(storage2, s);
+	ctx.env.enterscope();
+	for (int i = formals->first(); formals->more(i); i = formals->next(i)){
+		ctx.env.addid(formals->nth(i)->get_name(), frame_slot(n));
+		n++;
 	}
-	int pos = 3 + getNextTemp(storage2);
+	ctx.env.addid(self, frame_slot(n));
 
-	emit_store(ACC, pos, FP, s);
-	storage2[identifier] = new StorageInfo(FP, pos);
-
-	body->code(storage2, s);
+	ctx.begin_frame(-1);
+	expr->resolve(ctx);
+	frame_slots = ctx.end_frame();
+	ctx.env.exitscope();
 }
 
-enum OP {plus_op, sub_op, mul_op, div_op };
-
-void emit_arith(OP op, ostream &s)
+//
+// Resolves the features of this class and then of its subclasses.  n is
+// the word offset of the first attribute this class adds to its parent.
+//
+void CgenNode::resolve(ResolveContext &ctx, int n)
 {
-	switch (op){
-	case plus_op:
-		emit_add(T1, T1, T2, s);
+	ctx.env.enterscope();
+	for (int i = features->first(); features->more(i); i = features->next(i)){
+		features->nth(i)->bind_attribute(ctx, n);
+	}
+
+	ctx.classname = name;
+
+	// Class_init keeps self right below the saved registers, at -1($fp),
+	// and the let/case slots of all initializers below it.
+	ctx.begin_frame(-2);
+	ctx.env.enterscope();
+	ctx.env.addid(self, frame_slot(-1));
+	for (int i = features->first(); features->more(i); i = features->next(i)){
+		features->nth(i)->resolve_init(ctx);
+	}
+	ctx.env.exitscope();
+	init_slots = 1 + ctx.end_frame();
+
+	for (int i = features->first(); features->more(i); i = features->next(i)){
+		features->nth(i)->resolve(ctx);
+	}
+
+	for (List<CgenNode> *l = children; l != NULL; l = l->tl()){
+		l->hd()->resolve(ctx, n);
+	}
+	ctx.env.exitscope();
+}
+
+void branch_class::resolve(ResolveContext &ctx)
+{
+	loc = ctx.bind(name);
+	expr->resolve(ctx);
+	ctx.unbind();
+}
+
+void assign_class::resolve(ResolveContext &ctx)
+{
+	expr->resolve(ctx);
+	loc = ctx.env.lookup(name);
+	loc->assigned = true;
+	ctx.use(loc);
+}
+
+//
+// Class hierarchy analysis (-O).  A dispatch on static type T reaches
+// the method T inherits or defines, or an override of it in a subclass
+// of T.  When no subclass overrides it, which is always the case for
+// Int, Bool and String, the call goes straight to that method.
+//
+
+// The method name that class c itself defines, or NULL.
+static method_class *own_method(CgenNodeP c, Symbol name)
+{
+	Features fs = c->features;
+	for (int i = fs->first(); fs->more(i); i = fs->next(i)){
+		method_class *m = dynamic_cast<method_class *>(fs->nth(i));
+		if (m != NULL && m->name == name) return m;
+	}
+	return NULL;
+}
+
+static bool overridden_below(CgenNodeP c, Symbol name)
+{
+	for (List<CgenNode> *l = c->get_children(); l != NULL; l = l->tl())
+		if (own_method(l->hd(), name) || overridden_below(l->hd(), name)) return true;
+	return false;
+}
+
+// The class whose method `name' every dispatch on cls calls, or NULL.
+static Symbol unique_target(Symbol cls, Symbol name)
+{
+	static std::map<std::pair<Symbol, Symbol>, Symbol> memo;
+	auto key = std::make_pair(cls, name);
+	auto p = memo.find(key);
+	if (p != memo.end()) return p->second;
+
+	CgenNodeP c = classTable[cls];
+	Symbol target = NULL;
+	if (!overridden_below(c, name)){
+		while (!own_method(c, name)) c = c->get_parentnd();
+		target = c->get_name();
+	}
+	return memo[key] = target;
+}
+
+// The class whose method `name' is found from cls.
+static Symbol method_owner(Symbol cls, Symbol name)
+{
+	CgenNodeP c = classTable[cls];
+	while (!own_method(c, name)) c = c->get_parentnd();
+	return c->get_name();
+}
+
+void static_dispatch_class::resolve(ResolveContext &ctx)
+{
+	resolve_list(actual, ctx);
+	expr->resolve(ctx);
+	slot = dispatchTable[type_name][name];
+	if (cgen_optimize) target = method_owner(type_name, name);
+}
+
+void dispatch_class::resolve(ResolveContext &ctx)
+{
+	resolve_list(actual, ctx);
+	expr->resolve(ctx);
+	Symbol T = (expr->type == SELF_TYPE) ? ctx.classname : expr->type;
+	slot = dispatchTable[T][name];
+
+	ctx.dispatches++;
+	if (cgen_optimize && (target = unique_target(T, name)) != NULL)
+		ctx.devirtualized++;
+}
+
+void cond_class::resolve(ResolveContext &ctx)
+{
+	pred->resolve(ctx);
+	then_exp->resolve(ctx);
+	else_exp->resolve(ctx);
+}
+
+void loop_class::resolve(ResolveContext &ctx)
+{
+	int start = ctx.begin_loop();
+	pred->resolve(ctx);
+	body->resolve(ctx);
+	ctx.end_loop(start);
+}
+
+void typcase_class::resolve(ResolveContext &ctx)
+{
+	expr->resolve(ctx);
+	for (int i = cases->first(); cases->more(i); i = cases->next(i))
+		cases->nth(i)->resolve(ctx);
+}
+
+void block_class::resolve(ResolveContext &ctx)
+{
+	resolve_list(body, ctx);
+}
+
+void let_class::resolve(ResolveContext &ctx)
+{
+	init->resolve(ctx);
+	loc = ctx.bind(identifier);
+	body->resolve(ctx);
+	ctx.unbind();
+}
+
+void plus_class::resolve(ResolveContext &ctx)   { e1->resolve(ctx); e2->resolve(ctx); }
+void sub_class::resolve(ResolveContext &ctx)    { e1->resolve(ctx); e2->resolve(ctx); }
+void mul_class::resolve(ResolveContext &ctx)    { e1->resolve(ctx); e2->resolve(ctx); }
+void divide_class::resolve(ResolveContext &ctx) { e1->resolve(ctx); e2->resolve(ctx); }
+void lt_class::resolve(ResolveContext &ctx)     { e1->resolve(ctx); e2->resolve(ctx); }
+void eq_class::resolve(ResolveContext &ctx)     { e1->resolve(ctx); e2->resolve(ctx); }
+void leq_class::resolve(ResolveContext &ctx)    { e1->resolve(ctx); e2->resolve(ctx); }
+void neg_class::resolve(ResolveContext &ctx)    { e1->resolve(ctx); }
+void comp_class::resolve(ResolveContext &ctx)   { e1->resolve(ctx); }
+void isvoid_class::resolve(ResolveContext &ctx) { e1->resolve(ctx); }
+
+void int_const_class::resolve(ResolveContext &ctx) { }
+void bool_const_class::resolve(ResolveContext &ctx) { }
+void string_const_class::resolve(ResolveContext &ctx) { }
+void new__class::resolve(ResolveContext &ctx) { }
+void no_expr_class::resolve(ResolveContext &ctx) { }
+
+void object_class::resolve(ResolveContext &ctx)
+{
+	loc = ctx.env.lookup(name);
+	ctx.use(loc);
+}
+
+//******************************************************************
+//
+//   Fill in the following methods to produce code for the
+//   appropriate expression.  You may add or remove parameters
+//   as you wish, but if you do, remember to change the parameters
+//   of the declarations in `cool-tree.h'  Sample code for
+//   constant integers, strings, and booleans are provided.
+//
+//*****************************************************************
+
+//
+// A case branch matches the classes whose tags are in the range of its
+// declared type, and an object takes the branch of its nearest ancestor.
+// case_ranges splits the tags into runs that take the same branch: the
+// first tag of every run, in order, and the index of its branch, or -1
+// if no branch matches.  The tag of the object is looked up among them
+// by binary search.
+//
+static std::vector<std::pair<int, int> > case_ranges(Cases cases)
+{
+	std::vector<std::pair<int, int> > by_tag;
+	for (int i = cases->first(); cases->more(i); i = cases->next(i))
+		by_tag.push_back(std::make_pair(classTable[cases->nth(i)->get_type()]->tag(), i));
+	std::sort(by_tag.begin(), by_tag.end());
+
+	// A subclass comes after its ancestors, and overwrites their ranges.
+	std::vector<int> branch(classTable[Object]->last_tag() + 1, -1);
+	for (auto const& b : by_tag){
+		CgenNodeP c = classTable[cases->nth(b.second)->get_type()];
+		std::fill(branch.begin() + c->tag(), branch.begin() + c->last_tag() + 1, b.second);
+	}
+
+	std::vector<std::pair<int, int> > ranges;
+	for (size_t t = 0; t < branch.size(); t++)
+		if (t == 0 || branch[t] != branch[t - 1])
+			ranges.push_back(std::make_pair((int) t, branch[t]));
+	return ranges;
+}
+
+// Jumps to the branch of the tag in T1, among ranges lo to hi.
+static void code_case_search(std::vector<std::pair<int, int> > const& ranges, size_t lo, size_t hi,
+                             std::vector<int> const& label, int abort, MipsCode &s)
+{
+	if (hi - lo == 1){
+		int b = ranges[lo].second;
+		emit_branch(b < 0 ? abort : label[b], s);
+		return;
+	}
+	size_t mid = (lo + hi) / 2;
+	int low = generate_label();
+	emit_blti(T1, ranges[mid].first, low, s);
+	code_case_search(ranges, mid, hi, label, abort, s);
+	emit_label_def(low, s);
+	code_case_search(ranges, lo, mid, label, abort, s);
+}
+
+void typcase_class::code(MipsCode &s) {
+	auto ranges = case_ranges(cases);
+	std::vector<int> label;
+	for (int i = cases->first(); cases->more(i); i = cases->next(i))
+		label.push_back(generate_label());
+	auto case_abort = generate_label();
+	auto end_typcase = generate_label();
+
+	expr->code(s);
+	emit_move(T2, ACC, s);
+	emit_error_ifisvoid("_case_abort2", s);
+
+	// T1 now stores the expression tag
+	emit_load(T1, TAG_OFFSET, ACC, s);
+	code_case_search(ranges, 0, ranges.size(), label, case_abort, s);
+
+	for (int i = cases->first(); cases->more(i); i = cases->next(i)){
+		emit_label_def(label[i], s);
+		emit_store(T2, static_cast<branch_class *>(cases->nth(i))->loc->offset, FP, s);
+
+		cases->nth(i)->code(s);
+		emit_branch(end_typcase, s);
+	}
+	emit_label_def(case_abort, s);
+	emit_jal("_case_abort", s); // runtime abort
+
+	emit_label_def(end_typcase, s);
+}
+
+void block_class::code(MipsCode &s) {
+	for (int i = body->first(); body->more(i); i = body->next(i)){
+		body->nth(i)->code(s);
+	}
+}
+
+void assign_class::code(MipsCode &s) {
+	emit_comment("assign_class", s);
+	expr->code(s);
+	emit_store(ACC, loc->offset, loc->reg, s);
+	if (loc->attribute && needs_write_barrier(expr)) emit_write_barrier(SELF, loc->offset, s);
+}
+
+
+void cond_class::code(MipsCode &s) {
+	auto cond_else = generate_label();
+	auto cond_exit = generate_label();
+
+	pred->code_branch(s, cond_else, false);
+	then_exp->code(s);
+	emit_branch(cond_exit, s);
+	emit_label_def(cond_else, s);
+	else_exp->code(s);
+	emit_label_def(cond_exit, s);
+}
+
+void loop_class::code(MipsCode &s) {
+	auto loop_start = generate_label();
+	auto loop_end = generate_label();
+
+	emit_label_def(loop_start, s);
+	pred->code_branch(s, loop_end, false);
+	body->code(s);
+	emit_branch(loop_start, s);
+	emit_label_def(loop_end, s);
+	emit_load_imm(ACC, 0, s);
+}
+
+void let_class::code(MipsCode &s) {
+	emit_comment("let_class", s);
+
+	if ((!init->type || init->type == No_type) &&
+				(type_decl == Str || type_decl == Int || type_decl == Bool)){
+		emit_new(type_decl, s);
+	} else {
+		init->code(s);
+	}
+	emit_store(ACC, loc->offset, loc->reg, s);
+
+	body->code(s);
+}
+
+enum OP {plus_op, sub_op, mul_op, div_op };
+
+void emit_arith(OP op, MipsCode &s)
+{
+	switch (op){
+	case plus_op:
+		emit_add(T1, T1, T2, s);
 		break;
 	case sub_op:
 		emit_sub(T1, T1, T2, s);
@@ -1578,24 +2093,16 @@ void emit_arith(OP op, ostream &s)
 		break;
 	}
 
-	emit_store(T1, 0, SP, s);
-	emit_addiu(SP, SP, -4, s);
-
-	emit_new(Int, s);
-
-	emit_load(T1, 1, SP, s);
-	emit_addiu(SP, SP, 4, s);
-	emit_store(T1, 3, ACC, s);
+	emit_box_int(s);
 }
 
-void plus_class::code(Storage &storage,ostream &s) {
-	Storage storage2 = storage;
+void plus_class::code(MipsCode &s) {
 
-	e1->code(storage2, s);
+	e1->code(s);
 	emit_store(ACC, 0, SP, s);
 	emit_addiu(SP, SP, -4, s);
 
-	e2->code(storage2, s);
+	e2->code(s);
 	emit_load(T1, 1, SP, s);
 	emit_addiu(SP, SP, 4, s);
 
@@ -1604,14 +2111,13 @@ void plus_class::code(Storage &storage,ostream &s) {
 	emit_arith(plus_op, s);
 }
 
-void sub_class::code(Storage &storage,  ostream &s) {
-	Storage storage2 = storage;
+void sub_class::code(MipsCode &s) {
 
-	e1->code(storage2, s);
+	e1->code(s);
 	emit_store(ACC, 0, SP, s);
 	emit_addiu(SP, SP, -4, s);
 
-	e2->code(storage2, s);
+	e2->code(s);
 	emit_load(T1, 1, SP, s);
 	emit_addiu(SP, SP, 4, s);
 
@@ -1620,14 +2126,13 @@ void sub_class::code(Storage &storage,  ostream &s) {
 	emit_arith(sub_op, s);
 }
 
-void mul_class::code(Storage &storage,ostream &s) {
-	Storage storage2 = storage;
+void mul_class::code(MipsCode &s) {
 
-	e1->code(storage2, s);
+	e1->code(s);
 	emit_store(ACC, 0, SP, s);
 	emit_addiu(SP, SP, -4, s);
 
-	e2->code(storage2, s);
+	e2->code(s);
 	emit_load(T1, 1, SP, s);
 	emit_addiu(SP, SP, 4, s);
 
@@ -1636,14 +2141,13 @@ void mul_class::code(Storage &storage,ostream &s) {
 	emit_arith(mul_op, s);
 }
 
-void divide_class::code(Storage &storage,ostream &s) {
-	Storage storage2 = storage;
+void divide_class::code(MipsCode &s) {
 
-	e1->code(storage2, s);
+	e1->code(s);
 	emit_store(ACC, 0, SP, s);
 	emit_addiu(SP, SP, -4, s);
 
-	e2->code(storage2, s);
+	e2->code(s);
 	emit_load(T1, 1, SP, s);
 	emit_addiu(SP, SP, 4, s);
 
@@ -1652,27 +2156,18 @@ void divide_class::code(Storage &storage,ostream &s) {
 	emit_arith(div_op, s);
 }
 
-void neg_class::code(Storage &storage,ostream &s) {
-	Storage storage2 = storage;
-	e1->code(storage2, s);
+void neg_class::code(MipsCode &s) {
+	e1->code(s);
 	emit_load(T1, INT_SLOTS, ACC,s);
 
 	emit_neg(T1, T1, s);
 
-	emit_store(T1, 0, SP, s);
-	emit_addiu(SP, SP, -4, s);
-
-	emit_new(Int, s);
-
-	emit_load(T1, 1, SP, s);
-	emit_addiu(SP, SP, 4, s);
-
-	emit_store(T1, INT_SLOTS, ACC, s);
+	emit_box_int(s);
 }
 
-void emit_comparison( char const* const op, ostream &s)
+void emit_comparison(MipsOp op, MipsCode &s)
 {
-	auto cmp_exit = generate_label("cmp_exit");
+	auto cmp_exit = generate_label();
 	emit_load_bool(ACC, truebool, s);
 	emit_load_bool(A1, falsebool, s);
 	emit_cmp(op, T1, T2, cmp_exit, s);
@@ -1680,58 +2175,65 @@ void emit_comparison( char const* const op, ostream &s)
 	emit_label_def(cmp_exit, s);
 }
 
-void lt_class::code(Storage &storage,ostream &s) {
-	Storage storage2 = storage;
+//
+// code_branch() codes a Bool expression in a predicate: it jumps to
+// label if the value is sense and falls through otherwise.  The
+// comparisons, not and isvoid branch on their operands directly, and
+// never make the Bool object.
+//
+void Expression_class::code_branch(MipsCode &s, int label, bool sense)
+{
+	code(s);
+	emit_load(T1, BOOL_SLOTS, ACC, s);
+	if (sense) emit_bnez(T1, label, s);
+	else emit_beqz(T1, label, s);
+}
 
+// Leaves the values of the Int expressions e1 and e2 in T1 and T2.
+static void code_int_operands(Expression e1, Expression e2, MipsCode &s)
+{
 	// Load the first integer in T1 and put save it on the stack
-	e1->code(storage2, s);
+	e1->code(s);
 	emit_load(T1, INT_SLOTS, ACC, s);
 	emit_store(T1, 0, SP, s);
 	emit_addiu(SP, SP, -4, s);
 
 	// Load the second integer in T2 and load T1 from the stack
-	e2->code(storage2, s);
+	e2->code(s);
 	emit_load(T2, INT_SLOTS, ACC, s);
 
 	emit_load(T1, 1, SP, s);
 	emit_addiu(SP, SP, 4, s);
-
-	// Compare T1 T2
-	emit_comparison(BLT, s);
-
 }
 
-void leq_class::code(Storage &storage,ostream &s) {
-	Storage storage2 = storage;
-	e1->code(storage2, s);
-	emit_load(T1, INT_SLOTS, ACC, s);
-
-	emit_store(T1, 0, SP, s);
-	emit_addiu(SP, SP, -4, s);
-
-	e2->code(storage2, s);
-	emit_load(T2, INT_SLOTS, ACC, s);
-
-	emit_store(T2, 0, SP, s);
-	emit_addiu(SP, SP, -4, s);
+void lt_class::code(MipsCode &s) {
+	code_int_operands(e1, e2, s);
+	emit_comparison(M_BLT, s);
+}
 
-	emit_load_bool(ACC, truebool, s);
-	emit_load_bool(A1, falsebool, s);
+void lt_class::code_branch(MipsCode &s, int label, bool sense) {
+	code_int_operands(e1, e2, s);
+	emit_cmp(sense ? M_BLT : M_BGE, T1, T2, label, s);
+}
 
-	emit_comparison(BLEQ, s);
-	emit_addiu(SP, SP, 8, s);
+void leq_class::code(MipsCode &s) {
+	code_int_operands(e1, e2, s);
+	emit_comparison(M_BLE, s);
 }
 
-void eq_class::code(Storage &storage,ostream &s) {
-	auto same_ptr = generate_label("same_ptr");
-	emit_comment("eq_class", s);
-	Storage storage2 = storage;
+void leq_class::code_branch(MipsCode &s, int label, bool sense) {
+	code_int_operands(e1, e2, s);
+	emit_cmp(sense ? M_BLE : M_BGT, T1, T2, label, s);
+}
 
-	e1->code(storage2, s);
+// Leaves the objects e1 and e2 in T1 and T2, and true in ACC.
+static void code_eq_operands(Expression e1, Expression e2, MipsCode &s)
+{
+	e1->code(s);
 	emit_store(ACC, 0, SP, s);
 	emit_addiu(SP, SP, -4, s);
 
-	e2->code(storage2, s);
+	e2->code(s);
 	emit_store(ACC, 0, SP, s);
 	emit_addiu(SP, SP, -4, s);
 
@@ -1742,19 +2244,43 @@ void eq_class::code(Storage &storage,ostream &s) {
 	emit_addiu(SP, SP, 4, s);
 
 	emit_load_bool(ACC, truebool, s);
+}
 
+void eq_class::code(MipsCode &s) {
+	auto same_ptr = generate_label();
+	emit_comment("eq_class", s);
+
+	code_eq_operands(e1, e2, s);
 	emit_beq(T1, T2, same_ptr, s);
 	emit_load_bool(A1, falsebool, s);
 	emit_jal("equality_test", s);
 	emit_label_def(same_ptr, s);
 }
 
-void comp_class::code(Storage &storage,ostream &s) {
-	auto neg_label = generate_label("neg_label");
-	auto neg_exit = generate_label("net_exit");
+// Identical objects are equal without calling equality_test.
+void eq_class::code_branch(MipsCode &s, int label, bool sense) {
+	auto done = generate_label();
+	emit_comment("eq_class", s);
+
+	code_eq_operands(e1, e2, s);
+	emit_beq(T1, T2, sense ? label : done, s);
+	emit_load_bool(A1, falsebool, s);
+	emit_jal("equality_test", s);
+	emit_load(T1, BOOL_SLOTS, ACC, s);
+	if (sense) emit_bnez(T1, label, s);
+	else emit_beqz(T1, label, s);
+	emit_label_def(done, s);
+}
+
+void comp_class::code_branch(MipsCode &s, int label, bool sense) {
+	e1->code_branch(s, label, !sense);
+}
+
+void comp_class::code(MipsCode &s) {
+	auto neg_label = generate_label();
+	auto neg_exit = generate_label();
 
-	Storage storage2 = storage;
-	e1->code(storage2, s);
+	e1->code(s);
 	emit_load(T1, BOOL_SLOTS, ACC, s);
 
 	emit_beqz(T1, neg_label, s);
@@ -1765,7 +2291,7 @@ void comp_class::code(Storage &storage,ostream &s) {
 	emit_label_def(neg_exit, s);
 }
 
-void int_const_class::code(Storage &storage,ostream& s)
+void int_const_class::code(MipsCode &s)
 {
   //
   // Need to be sure we have an IntEntry *, not an arbitrary Symbol
@@ -1773,20 +2299,25 @@ void int_const_class::code(Storage &storage,ostream& s)
   emit_load_int(ACC,inttable.lookup_string(token->get_string()),s);
 }
 
-void string_const_class::code(Storage &storage,ostream& s)
+void string_const_class::code(MipsCode &s)
 {
   emit_load_string(ACC,stringtable.lookup_string(token->get_string()),s);
 }
 
-void bool_const_class::code(Storage &storage,ostream& s)
+void bool_const_class::code(MipsCode &s)
+{
+  emit_load_bool(ACC, val ? truebool : falsebool, s);
+}
+
+void bool_const_class::code_branch(MipsCode &s, int label, bool sense)
 {
-  emit_load_bool(ACC, BoolConst(val), s);
+  if ((bool) val == sense) emit_branch(label, s);
 }
 
-void emit_is_void(ostream &s)
+void emit_is_void(MipsCode &s)
 {
-	auto isvoid_label = generate_label("isvoid_label");
-	auto exit_isvoid = generate_label("exit_isvoid");
+	auto isvoid_label = generate_label();
+	auto exit_isvoid = generate_label();
 
 
 	emit_beqz(ACC, isvoid_label, s);
@@ -1798,21 +2329,1475 @@ void emit_is_void(ostream &s)
 	emit_label_def(exit_isvoid, s);
 }
 
-void isvoid_class::code(Storage &storage,ostream &s) {
-	Storage storage2 = storage;
+void isvoid_class::code(MipsCode &s) {
 	emit_comment("isvoid", s);
-	e1->code(storage, s);
+	e1->code(s);
 	emit_is_void(s);
 }
 
-void no_expr_class::code(Storage &storage,ostream &s) {
+void isvoid_class::code_branch(MipsCode &s, int label, bool sense) {
+	emit_comment("isvoid", s);
+	e1->code(s);
+	if (sense) emit_beqz(ACC, label, s);
+	else emit_bnez(ACC, label, s);
+}
+
+void no_expr_class::code(MipsCode &s) {
 	emit_comment("no_expr", s);
 	emit_load_imm(ACC, 0, s);
 }
 
-void object_class::code(Storage &storage,ostream &s) {
+void object_class::code(MipsCode &s) {
 	emit_comment("variable", s);
-	char *  reg = storage[name]->reg;
-	int offset = storage[name]->offset;
-	emit_load(ACC, offset, reg, s);
+	emit_load(ACC, loc->offset, loc->reg, s);
+}
+
+//******************************************************************
+//
+//   Constant folding (-O)
+//
+//   fold() runs after the resolve pass and before the constants are
+//   emitted, and returns the node to use in place of an expression: a
+//   constant for an arithmetic, comparison, not or isvoid of constants,
+//   the taken arm of an if with a constant predicate, and the value of
+//   a let binding initialized with a constant and never assigned.
+//   Arithmetic wraps around at 32 bits like the MIPS instructions.  A
+//   division by zero, or of the least Int by -1, is left to trap at run
+//   time.  The program is resolved again afterwards.
+//
+//*****************************************************************
+
+static bool int_value(Expression e, int &v)
+{
+	int_const_class *c = dynamic_cast<int_const_class *>(e);
+	if (c == NULL) return false;
+	v = (int) (unsigned) strtoull(c->token->get_string(), NULL, 10);
+	return true;
+}
+
+static bool bool_value(Expression e, bool &v)
+{
+	bool_const_class *c = dynamic_cast<bool_const_class *>(e);
+	if (c == NULL) return false;
+	v = c->val;
+	return true;
+}
+
+static bool string_value(Expression e, Symbol &v)
+{
+	string_const_class *c = dynamic_cast<string_const_class *>(e);
+	if (c == NULL) return false;
+	v = c->token;
+	return true;
+}
+
+static bool is_constant(Expression e)
+{
+	int i;
+	bool b;
+	Symbol s;
+	return int_value(e, i) || bool_value(e, b) || string_value(e, s);
+}
+
+static Expression fold_int(int v, FoldContext &ctx)
+{
+	ctx.folded++;
+	return int_const(inttable.add_int(v))->set_type(Int);
+}
+
+static Expression fold_bool(bool v, FoldContext &ctx)
+{
+	ctx.folded++;
+	return bool_const(v)->set_type(Bool);
+}
+
+static Expressions fold_list(Expressions l, FoldContext &ctx)
+{
+	Expressions r = nil_Expressions();
+	bool changed = false;
+	for (int i = l->first(); l->more(i); i = l->next(i)){
+		Expression e = l->nth(i);
+		Expression f = e->fold(ctx);
+		changed |= f != e;
+		r = append_Expressions(r, single_Expressions(f));
+	}
+	return changed ? r : l;
+}
+
+static Expression fold_arith(Expression e, OP op, Expression &e1, Expression &e2, FoldContext &ctx)
+{
+	e1 = e1->fold(ctx);
+	e2 = e2->fold(ctx);
+	int x, y;
+	if (!int_value(e1, x) || !int_value(e2, y)) return e;
+
+	unsigned a = x, b = y;
+	switch (op){
+	case plus_op: return fold_int(a + b, ctx);
+	case sub_op:  return fold_int(a - b, ctx);
+	case mul_op:  return fold_int(a * b, ctx);
+	case div_op:
+		if (y == 0 || (x == INT_MIN && y == -1)) return e;
+		return fold_int(x / y, ctx);
+	}
+	return e;
+}
+
+void method_class::fold(FoldContext &ctx) { expr = expr->fold(ctx); }
+void attr_class::fold(FoldContext &ctx)   { init = init->fold(ctx); }
+void branch_class::fold(FoldContext &ctx) { expr = expr->fold(ctx); }
+
+Expression assign_class::fold(FoldContext &ctx)
+{
+	expr = expr->fold(ctx);
+	return this;
+}
+
+Expression static_dispatch_class::fold(FoldContext &ctx)
+{
+	actual = fold_list(actual, ctx);
+	expr = expr->fold(ctx);
+	return this;
+}
+
+Expression dispatch_class::fold(FoldContext &ctx)
+{
+	actual = fold_list(actual, ctx);
+	expr = expr->fold(ctx);
+	return this;
+}
+
+Expression cond_class::fold(FoldContext &ctx)
+{
+	pred = pred->fold(ctx);
+	then_exp = then_exp->fold(ctx);
+	else_exp = else_exp->fold(ctx);
+	bool v;
+	if (!bool_value(pred, v)) return this;
+	// The arm taken replaces the cond only when it has the cond's type:
+	// in if true then 1 else "a" fi the 1 is an Object, not an Int.
+	Expression arm = v ? then_exp : else_exp;
+	if (arm->type != type) return this;
+	ctx.folded++;
+	return arm;
+}
+
+Expression loop_class::fold(FoldContext &ctx)
+{
+	pred = pred->fold(ctx);
+	body = body->fold(ctx);
+	return this;
+}
+
+Expression typcase_class::fold(FoldContext &ctx)
+{
+	expr = expr->fold(ctx);
+	for (int i = cases->first(); cases->more(i); i = cases->next(i))
+		cases->nth(i)->fold(ctx);
+	return this;
+}
+
+Expression block_class::fold(FoldContext &ctx)
+{
+	body = fold_list(body, ctx);
+	return this;
+}
+
+Expression let_class::fold(FoldContext &ctx)
+{
+	init = init->fold(ctx);
+	if (!loc->assigned && init->type == type_decl && is_constant(init))
+		ctx.constants[loc] = init;
+	body = body->fold(ctx);
+	return this;
+}
+
+Expression plus_class::fold(FoldContext &ctx)   { return fold_arith(this, plus_op, e1, e2, ctx); }
+Expression sub_class::fold(FoldContext &ctx)    { return fold_arith(this, sub_op, e1, e2, ctx); }
+Expression mul_class::fold(FoldContext &ctx)    { return fold_arith(this, mul_op, e1, e2, ctx); }
+Expression divide_class::fold(FoldContext &ctx) { return fold_arith(this, div_op, e1, e2, ctx); }
+
+Expression neg_class::fold(FoldContext &ctx)
+{
+	e1 = e1->fold(ctx);
+	int x;
+	if (!int_value(e1, x)) return this;
+	return fold_int(-(unsigned) x, ctx);
+}
+
+Expression lt_class::fold(FoldContext &ctx)
+{
+	e1 = e1->fold(ctx);
+	e2 = e2->fold(ctx);
+	int x, y;
+	if (!int_value(e1, x) || !int_value(e2, y)) return this;
+	return fold_bool(x < y, ctx);
+}
+
+Expression leq_class::fold(FoldContext &ctx)
+{
+	e1 = e1->fold(ctx);
+	e2 = e2->fold(ctx);
+	int x, y;
+	if (!int_value(e1, x) || !int_value(e2, y)) return this;
+	return fold_bool(x <= y, ctx);
+}
+
+// Equal strings are the same entry of stringtable.
+Expression eq_class::fold(FoldContext &ctx)
+{
+	e1 = e1->fold(ctx);
+	e2 = e2->fold(ctx);
+	int x, y;
+	bool a, b;
+	Symbol s, t;
+	if (int_value(e1, x) && int_value(e2, y)) return fold_bool(x == y, ctx);
+	if (bool_value(e1, a) && bool_value(e2, b)) return fold_bool(a == b, ctx);
+	if (string_value(e1, s) && string_value(e2, t)) return fold_bool(s == t, ctx);
+	return this;
+}
+
+Expression comp_class::fold(FoldContext &ctx)
+{
+	e1 = e1->fold(ctx);
+	bool v;
+	if (!bool_value(e1, v)) return this;
+	return fold_bool(!v, ctx);
+}
+
+Expression isvoid_class::fold(FoldContext &ctx)
+{
+	e1 = e1->fold(ctx);
+	if (!is_constant(e1)) return this;
+	return fold_bool(false, ctx);
+}
+
+Expression int_const_class::fold(FoldContext &ctx)    { return this; }
+Expression bool_const_class::fold(FoldContext &ctx)   { return this; }
+Expression string_const_class::fold(FoldContext &ctx) { return this; }
+Expression new__class::fold(FoldContext &ctx)         { return this; }
+Expression no_expr_class::fold(FoldContext &ctx)      { return this; }
+
+Expression object_class::fold(FoldContext &ctx)
+{
+	auto c = ctx.constants.find(loc);
+	if (c == ctx.constants.end()) return this;
+	ctx.folded++;
+	return c->second->copy_Expression()->set_type(c->second->type);
+}
+
+//******************************************************************
+//
+//   IR construction (-O)
+//
+//   build() appends the code of an expression to the current block of
+//   the IrBuilder and returns the temporary that holds its value.  The
+//   value of a variable is copied into a new temporary, since the
+//   variable may be assigned before the value is used.
+//
+//   Arithmetic, comparisons and Int and Bool let variables are kept
+//   raw, and boxed only where an object is needed: in an attribute, as
+//   the receiver or an argument of a dispatch, the result of a method,
+//   a case expression, or a value of another static type.  Int and
+//   Bool are never void, so they can be unboxed wherever their static
+//   type says they are one.
+//
+//*****************************************************************
+
+// The temporary a variable lives in, -1 for an attribute.
+static int variable_temp(IrBuilder &b, StorageInfo *loc)
+{
+	if (loc->attribute) return -1;
+	if (loc->local >= 0) return b.locals[loc];
+	int formal = loc->offset - 3;
+	return formal == (int) b.formals.size() ? b.self : b.formals[formal];
+}
+
+// The kind of temporary a variable of the given type is kept in.
+static IrKind raw_kind(Symbol type)
+{
+	if (type == Int) return IK_INT;
+	if (type == Bool) return IK_BOOL;
+	return IK_OBJ;
+}
+
+// Temporary t as an object.
+static int build_object(IrBuilder &b, int t)
+{
+	IrKind kind = b.f.temps[t].kind;
+	if (kind == IK_OBJ) return t;
+
+	Symbol cls = kind == IK_INT ? Int : Bool;
+	int dst = b.f.new_temp(IK_OBJ, cls);
+	IrInstr &box = b.emit(IrBuilder::make(IR_BOX, dst, t));
+	box.sym = cls;
+	box.imm = kind;
+	return dst;
+}
+
+// Temporary t, an Int or a Bool, as a raw value.
+static int build_unbox(IrBuilder &b, int t, IrKind kind)
+{
+	if (b.f.temps[t].kind != IK_OBJ) return t;
+	return b.value(IR_UNBOX, kind, kind == IK_INT ? Int : Bool, t);
+}
+
+static int build_as(IrBuilder &b, int t, IrKind kind)
+{
+	return kind == IK_OBJ ? build_object(b, t) : build_unbox(b, t, kind);
+}
+
+// The initial value of a let variable declared without initializer.
+static int build_default(IrBuilder &b, Symbol type)
+{
+	if (type == Int) return b.imm(0, IK_INT, Int);
+	if (type == Bool) return b.imm(0, IK_BOOL, Bool);
+	if (type == Str) return b.constant(MipsRef::string_const(stringtable.lookup_string("")), Str);
+	return b.imm(0, IK_OBJ, type);
+}
+
+//
+// Inlining.  A call that always reaches the same method is replaced by
+// the method's body when the body is at most COOL_INLINE_BUDGET IR
+// instructions (24 by default, 0 switches inlining off), and not
+// recursive.  Inside the body self is the receiver and every formal a
+// new temporary initialized with its argument, unboxed if it is an Int
+// or a Bool.  A dispatch on self of static type SELF_TYPE is resolved in
+// the class that owns the method, not in the receiver's class, which may
+// be any subclass of it; new SELF_TYPE still copies the receiver.  Every
+// such call site gets a remark, printed as a comment before the code of
+// the function.
+//
+
+static int inline_budget()
+{
+	static int budget = -1;
+	if (budget < 0){
+		const char *e = getenv("COOL_INLINE_BUDGET");
+		budget = e != NULL && atoi(e) >= 0 ? atoi(e) : 24;
+	}
+	return budget;
+}
+
+// The number of IR instructions of the body of m, not counting its
+// return or any inlining.
+static int method_size(method_class *m, Symbol cls)
+{
+	static std::map<method_class *, int> memo;
+	auto p = memo.find(m);
+	if (p != memo.end()) return p->second;
+
+	IrFunction f(cls, m->name, m->formals->len());
+	build_method(m, f, false);
+	int n = -1;
+	for (auto const& b : f.blocks) n += b.code.size();
+	return memo[m] = n;
+}
+
+// Builds the body of target's method name in place of a call to it,
+// and returns its value, or -1 if the call is to be made.
+static int build_inline(IrBuilder &b, Symbol target, Symbol name, int recv, std::vector<int> const& args)
+{
+	CgenNodeP c = classTable[target];
+	method_class *m = c->basic() ? NULL : own_method(c, name);
+	if (m == NULL || !b.inline_calls || inline_budget() == 0) return -1;
+
+	auto key = std::make_pair(target, name);
+	int size = method_size(m, target);
+	bool inline_it = false;
+	std::ostringstream remark;
+	remark << "inline " << target << "." << name << " into " << b.f.cls << "." << b.f.name << ": ";
+	if (std::find(b.inlining.begin(), b.inlining.end(), key) != b.inlining.end())
+		remark << "no, recursive";
+	else if (b.inlining.size() > 4)
+		remark << "no, nested too deep";
+	else if (size > inline_budget())
+		remark << "no, size " << size << " over budget " << inline_budget();
+	else {
+		remark << "yes, size " << size;
+		inline_it = true;
+	}
+	b.f.remarks.push_back(remark.str());
+	if (!inline_it) return -1;
+
+	Symbol cls = b.cls;
+	int self = b.self;
+	std::vector<int> formals;
+	formals.swap(b.formals);
+	for (int i = m->formals->first(); m->formals->more(i); i = m->formals->next(i)){
+		formal_class *formal = static_cast<formal_class *>(m->formals->nth(i));
+		IrKind kind = raw_kind(formal->type_decl);
+		int t = b.f.new_temp(kind, formal->type_decl);
+		b.copy(t, build_as(b, args[i], kind));
+		b.formals.push_back(t);
+	}
+	b.cls = target;		// the owner, the receiver may be of a subclass
+	b.self = recv;
+	b.inlining.push_back(key);
+
+	int r = m->expr->build(b);
+
+	b.inlining.pop_back();
+	b.cls = cls;
+	b.self = self;
+	b.formals.swap(formals);
+	return r;
+}
+
+static int build_call(IrBuilder &b, Expressions actual, Expression expr,
+                      Symbol cls, Symbol name, int slot, int flags, Symbol target, Symbol type)
+{
+	std::vector<int> args;
+	for (int i = actual->first(); actual->more(i); i = actual->next(i))
+		args.push_back(actual->nth(i)->build(b));
+
+	int recv = build_object(b, expr->build(b));
+	b.emit(IrBuilder::make(IR_CHECK_VOID, -1, recv)).imm = IR_VOID_DISPATCH;
+
+	if (target){
+		int r = build_inline(b, target, name, recv, args);
+		if (r >= 0) return r;
+	}
+	for (int &a : args) a = build_object(b, a);
+
+	int dst = b.f.new_temp(IK_OBJ, type);
+	IrInstr &call = b.emit(IrBuilder::make(IR_CALL, dst, recv));
+	call.imm = slot;
+	call.flags = target ? flags | IR_DIRECT : flags;
+	call.sym = target ? target : cls;
+	call.sym2 = name;
+	call.args = args;
+	return dst;
+}
+
+static int build_arith(IrBuilder &b, IrOp op, Expression e1, Expression e2)
+{
+	int x = e1->build(b);
+	int y = e2->build(b);
+	return b.value(op, IK_INT, Int, build_unbox(b, x, IK_INT), build_unbox(b, y, IK_INT));
+}
+
+static int build_compare(IrBuilder &b, IrOp op, Expression e1, Expression e2)
+{
+	int x = e1->build(b);
+	int y = e2->build(b);
+	return b.value(op, IK_BOOL, Bool, build_unbox(b, x, IK_INT), build_unbox(b, y, IK_INT));
+}
+
+static void build_method(method_class *m, IrFunction &f, bool inline_calls)
+{
+	f.new_temp(IK_OBJ, SELF_TYPE);
+	for (int i = m->formals->first(); m->formals->more(i); i = m->formals->next(i))
+		f.new_temp(IK_OBJ, static_cast<formal_class *>(m->formals->nth(i))->type_decl);
+
+	IrBuilder b(f, inline_calls);
+	int r = build_object(b, m->expr->build(b));
+	b.emit(IrBuilder::make(IR_RETURN, -1, r));
+	f.compute_preds();
+}
+
+// The Int constant of value v, or NULL if the program has none.
+static IntEntry *int_entry(int v)
+{
+	static std::map<int, IntEntry *> entries;
+	static int known = 0;
+	for (; inttable.more(known); known++){
+		IntEntry *e = inttable.lookup(known);
+		entries[atoi(e->get_string())] = e;
+	}
+	auto p = entries.find(v);
+	return p == entries.end() ? NULL : p->second;
+}
+
+//
+// Removes the boxing that building expression by expression leaves
+// between them: an unboxed BOX is its operand, an unboxed constant an
+// immediate, and a boxed immediate a constant object when there is one.
+// Only temporaries written once are followed, and they are visited in
+// reverse postorder, so the definition is seen before the uses.
+//
+static void simplify_boxes(IrFunction &f)
+{
+	std::vector<int> defs(f.temps.size(), 0);
+	std::vector<IrInstr *> def(f.temps.size(), NULL);
+	for (auto &b : f.blocks)
+		for (auto &i : b.code)
+			if (i.dst >= 0){
+				defs[i.dst]++;
+				def[i.dst] = &i;
+			}
+	auto single = [&](int t) -> IrInstr * { return defs[t] == 1 ? def[t] : NULL; };
+
+	for (int n : f.reverse_postorder()){
+		for (auto &i : f.blocks[n].code){
+			IrInstr *d = i.a >= 0 ? single(i.a) : NULL;
+			if (!d) continue;
+
+			if (i.op == IR_UNBOX && d->op == IR_BOX && defs[d->a] <= 1){
+				i.op = IR_COPY;
+				i.a = d->a;
+			} else if (i.op == IR_UNBOX && d->op == IR_CONST && d->ref.kind == MipsRef::INT){
+				i.op = IR_IMM;
+				i.a = -1;
+				i.imm = atoi(((IntEntry *) d->ref.a)->get_string());
+			} else if (i.op == IR_UNBOX && d->op == IR_CONST && d->ref.kind == MipsRef::BOOL){
+				i.op = IR_IMM;
+				i.a = -1;
+				i.imm = d->ref.a == &truebool;
+			} else if (i.op == IR_BOX && d->op == IR_UNBOX && defs[d->a] <= 1){
+				i.op = IR_COPY;
+				i.a = d->a;
+			} else if (i.op == IR_BOX && d->op == IR_IMM){
+				IntEntry *e = i.sym == Int ? int_entry(d->imm) : NULL;
+				if (i.sym == Int && !e) continue;
+				i.op = IR_CONST;
+				i.a = -1;
+				i.ref = e ? MipsRef::int_const(e) : MipsRef::bool_const(d->imm ? &truebool : &falsebool);
+			}
+		}
+	}
+}
+
+//
+// With a collector no raw value may be in the frame, where it would be
+// taken for a pointer.  Turns the raw temporaries the register allocator
+// could neither keep in a register nor save outside the frame into
+// objects: each definition computes a new raw temporary and boxes it, or
+// is a constant object, and each use unboxes the object into another one
+// just before it.  Neither of those spans more than the call of the BOX,
+// into the runtime.
+//
+static void box_temps(IrFunction &f, std::vector<int> const& temps)
+{
+	std::vector<IrKind> raw(f.temps.size(), IK_OBJ);
+	for (int t : temps){
+		raw[t] = f.temps[t].kind;
+		f.temps[t].kind = IK_OBJ;
+		f.temps[t].cls = raw[t] == IK_INT ? Int : Bool;
+	}
+	auto boxed = [&](int t){ return t >= 0 && t < (int) raw.size() && raw[t] != IK_OBJ; };
+	auto box = [&](int dst, int a){
+		IrInstr i = IrBuilder::make(IR_BOX, dst, a);
+		i.sym = f.temps[dst].cls;
+		i.imm = raw[dst];
+		return i;
+	};
+
+	for (auto &b : f.blocks){
+		std::vector<IrInstr> code;
+		for (IrInstr i : b.code){
+			if (i.op == IR_COPY && boxed(i.dst) && !boxed(i.a)){
+				code.push_back(box(i.dst, i.a));
+				continue;
+			}
+			if (i.op == IR_IMM && boxed(i.dst)){
+				IntEntry *e = raw[i.dst] == IK_INT ? int_entry(i.imm) : NULL;
+				if (raw[i.dst] == IK_BOOL || e){
+					i.op = IR_CONST;
+					i.ref = e ? MipsRef::int_const(e) : MipsRef::bool_const(i.imm ? &truebool : &falsebool);
+					code.push_back(i);
+					continue;
+				}
+			}
+			if (i.op == IR_UNBOX && boxed(i.dst)) i.op = IR_COPY;
+			if (i.op == IR_BOX && boxed(i.a)){
+				i.op = IR_COPY;
+				i.sym = NULL;
+				i.imm = 0;
+			}
+			if (i.op == IR_COPY && (boxed(i.dst) || boxed(i.a)) &&
+					f.temps[i.dst].kind == IK_OBJ && f.temps[i.a].kind == IK_OBJ){
+				code.push_back(i);
+				continue;
+			}
+
+			auto unbox = [&](int &t){
+				if (!boxed(t)) return;
+				int u = f.new_temp(raw[t], f.temps[t].cls);
+				code.push_back(IrBuilder::make(IR_UNBOX, u, t));
+				t = u;
+			};
+			unbox(i.a);
+			unbox(i.b);
+			for (int &t : i.args) unbox(t);
+
+			int t = i.dst;
+			if (!boxed(t)){
+				code.push_back(i);
+				continue;
+			}
+			i.dst = f.new_temp(raw[t], f.temps[t].cls);
+			code.push_back(i);
+			code.push_back(box(t, i.dst));
+		}
+		b.code.swap(code);
+	}
+}
+
+// The declared classes of the attributes of class n, by offset.
+static void attribute_types(CgenNodeP n, std::vector<Symbol> &types)
+{
+	if (n->get_parent() != No_class) attribute_types(n->get_parentnd(), types);
+	for (int i = n->features->first(); n->features->more(i); i = n->features->next(i)){
+		attr_class *a = dynamic_cast<attr_class *>(n->features->nth(i));
+		if (a) types.push_back(a->type_decl == SELF_TYPE ? n->name : a->type_decl);
+	}
+}
+
+//
+// Replaces the objects that never leave the method by their attributes.
+// An object qualifies when it is made by a new of a class with nothing
+// to initialize, and the temporaries that may hold it, which are the
+// result of the new and copies of it, only have their attributes read
+// and written and are checked for void.  An object that is passed to a
+// call, returned, stored or compared on any path stays on the heap as a
+// whole, and so does one held by self, a formal or a temporary that
+// may hold another value, whose attributes might not be the object's.
+// Calls into methods that are inlined are seen through.
+//
+// The attributes become temporaries, set from the protObj where the new
+// was, and every read and write of one a copy.
+//
+static void replace_scalars(IrFunction &f)
+{
+	std::vector<int> tried;
+	for (bool again = true; again; ){
+		again = false;
+		std::vector<int> defs(f.temps.size(), 0);
+		IrInstr const *found = NULL;
+		for (auto const& b : f.blocks)
+			for (auto const& i : b.code){
+				if (i.dst >= 0) defs[i.dst]++;
+				if (!found && i.op == IR_NEW && (i.flags & IR_NO_INIT) &&
+				    std::find(tried.begin(), tried.end(), i.dst) == tried.end())
+					found = &i;
+			}
+		if (!found) break;
+		int obj = found->dst;
+		Symbol cls = found->sym;
+		tried.push_back(obj);
+		again = true;
+		if (defs[obj] != 1) continue;
+
+		// The temporaries that may hold the object.
+		std::vector<char> holds(f.temps.size(), 0);
+		holds[obj] = 1;
+		for (bool changed = true; changed; ){
+			changed = false;
+			for (auto const& b : f.blocks)
+				for (auto const& i : b.code)
+					if (i.op == IR_COPY && holds[i.a] && !holds[i.dst]){
+						holds[i.dst] = 1;
+						changed = true;
+					}
+		}
+
+		// A holder with a value of its own on entry, self and the formals
+		// included, or set from anything but a holder, may hold another
+		// object where its attributes are used.
+		bool escapes = false;
+		IrLiveness live(f);
+		for (size_t t = 0; t < holds.size(); t++)
+			if (holds[t] && ((int) t == f.self() || f.is_formal(t) || live.in[0].has(t)))
+				escapes = true;
+		for (auto const& b : f.blocks)
+			for (auto const& i : b.code){
+				if (i.dst >= 0 && holds[i.dst] && i.dst != obj && !(i.op == IR_COPY && holds[i.a]))
+					escapes = true;
+				if (i.op == IR_GETATTR || i.op == IR_SETATTR || i.op == IR_CHECK_VOID ||
+				    i.op == IR_ISVOID || i.op == IR_COPY){
+					if (i.b >= 0 && holds[i.b]) escapes = true;
+				} else {
+					i.for_each_use([&](int t){ if (holds[t]) escapes = true; });
+				}
+			}
+		if (escapes) continue;
+
+		std::vector<Symbol> types;
+		attribute_types(classTable[cls], types);
+		std::vector<int> attr;
+		for (Symbol t : types) attr.push_back(f.new_temp(IK_OBJ, t));
+
+		for (auto &b : f.blocks){
+			std::vector<IrInstr> code;
+			for (auto const& i : b.code){
+				if (i.op == IR_NEW && i.dst == obj){
+					int proto = f.new_temp(IK_OBJ, cls);
+					code.push_back(IrBuilder::make(IR_CONST, proto));
+					code.back().ref = MipsRef::protobj(cls);
+					for (size_t k = 0; k < attr.size(); k++){
+						code.push_back(IrBuilder::make(IR_GETATTR, attr[k], proto));
+						code.back().imm = DEFAULT_OBJFIELDS + k;
+					}
+				} else if (i.a < 0 || !holds[i.a]){
+					code.push_back(i);
+				} else if (i.op == IR_GETATTR){
+					code.push_back(IrBuilder::make(IR_COPY, i.dst, attr[i.imm - DEFAULT_OBJFIELDS]));
+				} else if (i.op == IR_SETATTR){
+					code.push_back(IrBuilder::make(IR_COPY, attr[i.imm - DEFAULT_OBJFIELDS], i.b));
+				} else if (i.op == IR_ISVOID){
+					code.push_back(IrBuilder::make(IR_IMM, i.dst));
+				}
+				// Void checks and copies of the object go.
+			}
+			b.code.swap(code);
+		}
+
+		std::ostringstream remark;
+		remark << "replace new " << cls << " in " << f.cls << "." << f.name << " by "
+		       << attr.size() << " temporaries";
+		f.remarks.push_back(remark.str());
+	}
+}
+
+int static_dispatch_class::build(IrBuilder &b)
+{
+	return build_call(b, actual, expr, type_name, name, slot, IR_STATIC, target, type);
+}
+
+int dispatch_class::build(IrBuilder &b)
+{
+	Symbol cls = expr->type == SELF_TYPE ? b.cls : expr->type;
+	return build_call(b, actual, expr, cls, name, slot, 0, target, type);
+}
+
+//
+// The result is raw when both arms are, so the arms are built before
+// the copies into it are appended to them.
+//
+int cond_class::build(IrBuilder &b)
+{
+	int c = build_unbox(b, pred->build(b), IK_BOOL);
+	int then_block = b.f.new_block();
+	int else_block = b.f.new_block();
+	int join = b.f.new_block();
+	b.branch(c, then_block, else_block);
+
+	b.set_block(then_block);
+	int x = then_exp->build(b);
+	int then_end = b.cur;
+
+	b.set_block(else_block);
+	int y = else_exp->build(b);
+	int else_end = b.cur;
+
+	IrKind kind = b.f.temps[x].kind == b.f.temps[y].kind ? b.f.temps[x].kind : IK_OBJ;
+	int r = b.f.new_temp(kind, kind == IK_OBJ ? type : b.f.temps[x].cls);
+	b.set_block(then_end);
+	b.copy(r, build_as(b, x, kind));
+	b.jump(join);
+
+	b.set_block(else_end);
+	b.copy(r, build_as(b, y, kind));
+	b.jump(join);
+
+	b.set_block(join);
+	return r;
+}
+
+int loop_class::build(IrBuilder &b)
+{
+	int head = b.f.new_block();
+	int body_block = b.f.new_block();
+	int exit = b.f.new_block();
+	b.jump(head);
+
+	b.set_block(head);
+	b.branch(build_unbox(b, pred->build(b), IK_BOOL), body_block, exit);
+
+	b.set_block(body_block);
+	body->build(b);
+	b.jump(head);
+
+	b.set_block(exit);
+	return b.imm(0, IK_OBJ, Object);
+}
+
+// Jumps to the arm of the tag among ranges lo to hi, as code_case_search.
+static void build_case_search(IrBuilder &b, int tag, std::vector<std::pair<int, int> > const& ranges,
+                              size_t lo, size_t hi, std::vector<int> const& arm, int abort)
+{
+	if (hi - lo == 1){
+		int k = ranges[lo].second;
+		b.jump(k < 0 ? abort : arm[k]);
+		return;
+	}
+	size_t mid = (lo + hi) / 2;
+	int low = b.f.new_block();
+	int high = b.f.new_block();
+	b.branch(b.value(IR_LT, IK_BOOL, NULL, tag, b.imm(ranges[mid].first)), low, high);
+	b.set_block(low);
+	build_case_search(b, tag, ranges, lo, mid, arm, abort);
+	b.set_block(high);
+	build_case_search(b, tag, ranges, mid, hi, arm, abort);
+}
+
+int typcase_class::build(IrBuilder &b)
+{
+	int v = build_object(b, expr->build(b));
+	b.emit(IrBuilder::make(IR_CHECK_VOID, -1, v)).imm = IR_VOID_CASE;
+	int tag = b.value(IR_TAG, IK_INT, NULL, v);
+	int r = b.f.new_temp(IK_OBJ, type);
+	int join = b.f.new_block();
+
+	auto ranges = case_ranges(cases);
+	std::vector<int> arm;
+	for (int i = cases->first(); cases->more(i); i = cases->next(i))
+		arm.push_back(b.f.new_block());
+	int abort = -1;
+	for (auto const& range : ranges)
+		if (range.second < 0 && abort < 0) abort = b.f.new_block();
+	build_case_search(b, tag, ranges, 0, ranges.size(), arm, abort);
+
+	for (int i = cases->first(); cases->more(i); i = cases->next(i)){
+		branch_class *br = static_cast<branch_class *>(cases->nth(i));
+		b.set_block(arm[i]);
+		int var = b.f.new_temp(IK_OBJ, br->type_decl);
+		b.copy(var, v);
+		b.locals[br->loc] = var;
+		b.copy(r, build_object(b, br->expr->build(b)));
+		b.jump(join);
+	}
+	if (abort >= 0){
+		b.set_block(abort);
+		b.emit(IrBuilder::make(IR_CASE_ABORT, -1, v));
+	}
+
+	b.set_block(join);
+	return r;
+}
+
+int block_class::build(IrBuilder &b)
+{
+	int r = -1;
+	for (int i = body->first(); body->more(i); i = body->next(i))
+		r = body->nth(i)->build(b);
+	return r;
+}
+
+int assign_class::build(IrBuilder &b)
+{
+	int v = expr->build(b);
+	int var = variable_temp(b, loc);
+	if (var < 0)
+		b.emit(IrBuilder::make(IR_SETATTR, -1, b.self, build_object(b, v))).imm = loc->offset;
+	else
+		b.copy(var, build_as(b, v, b.f.temps[var].kind));
+	return v;
+}
+
+int let_class::build(IrBuilder &b)
+{
+	int v = (!init->type || init->type == No_type) ? build_default(b, type_decl) : init->build(b);
+	IrKind kind = raw_kind(type_decl);
+	int var = b.f.new_temp(kind, type_decl);
+	b.copy(var, build_as(b, v, kind));
+	b.locals[loc] = var;
+	return body->build(b);
+}
+
+int plus_class::build(IrBuilder &b)   { return build_arith(b, IR_ADD, e1, e2); }
+int sub_class::build(IrBuilder &b)    { return build_arith(b, IR_SUB, e1, e2); }
+int mul_class::build(IrBuilder &b)    { return build_arith(b, IR_MUL, e1, e2); }
+int divide_class::build(IrBuilder &b) { return build_arith(b, IR_DIV, e1, e2); }
+int lt_class::build(IrBuilder &b)     { return build_compare(b, IR_LT, e1, e2); }
+int leq_class::build(IrBuilder &b)    { return build_compare(b, IR_LE, e1, e2); }
+
+int neg_class::build(IrBuilder &b)
+{
+	int x = build_unbox(b, e1->build(b), IK_INT);
+	return b.value(IR_NEG, IK_INT, Int, x);
+}
+
+int comp_class::build(IrBuilder &b)
+{
+	int x = build_unbox(b, e1->build(b), IK_BOOL);
+	return b.value(IR_NOT, IK_BOOL, Bool, x);
+}
+
+// Two Ints or two Bools compare their values; anything else goes to
+// equality_test like eq_class::code.
+int eq_class::build(IrBuilder &b)
+{
+	int x = e1->build(b);
+	int y = e2->build(b);
+	IrKind kind = raw_kind(e1->type);
+	if (kind != IK_OBJ && kind == raw_kind(e2->type))
+		return b.value(IR_EQ, IK_BOOL, Bool, build_unbox(b, x, kind), build_unbox(b, y, kind));
+	return b.value(IR_EQUALS, IK_OBJ, Bool, build_object(b, x), build_object(b, y));
+}
+
+int isvoid_class::build(IrBuilder &b)
+{
+	int x = e1->build(b);
+	if (b.f.temps[x].kind != IK_OBJ) return b.imm(0, IK_BOOL, Bool);
+	return b.value(IR_ISVOID, IK_BOOL, Bool, x);
+}
+
+int int_const_class::build(IrBuilder &b)
+{
+	return b.constant(MipsRef::int_const(inttable.lookup_string(token->get_string())), Int);
+}
+
+int string_const_class::build(IrBuilder &b)
+{
+	return b.constant(MipsRef::string_const(stringtable.lookup_string(token->get_string())), Str);
+}
+
+int bool_const_class::build(IrBuilder &b)
+{
+	return b.constant(MipsRef::bool_const(val ? &truebool : &falsebool), Bool);
+}
+
+int new__class::build(IrBuilder &b)
+{
+	int dst = b.f.new_temp(IK_OBJ, type);
+	int a = type_name == SELF_TYPE ? b.self : -1;
+	IrInstr &i = b.emit(IrBuilder::make(IR_NEW, dst, a));
+	i.sym = type_name;
+	if (type_name != SELF_TYPE && !classTable[type_name]->has_init()) i.flags |= IR_NO_INIT;
+	return dst;
+}
+
+int no_expr_class::build(IrBuilder &b)
+{
+	return b.imm(0, IK_OBJ, Object);
+}
+
+int object_class::build(IrBuilder &b)
+{
+	int var = variable_temp(b, loc);
+	if (var == b.self) return var;
+
+	IrKind kind = var < 0 ? IK_OBJ : b.f.temps[var].kind;
+	int v = b.f.new_temp(kind, kind == IK_OBJ ? type : b.f.temps[var].cls);
+	if (var < 0)
+		b.emit(IrBuilder::make(IR_GETATTR, v, b.self)).imm = loc->offset;
+	else
+		b.copy(v, var);
+	return v;
+}
+
+//******************************************************************
+//
+//   IR lowering
+//
+//   The temporaries are placed by RegAlloc (see regalloc.h): self is in
+//   $s0, the others in a register or in their frame slot.  A formal's
+//   slot is the one it was passed in, self's is above the formals, and
+//   the slots of the other temporaries that need one are below the
+//   saved registers, followed by the slots of the $s registers the
+//   function saves.
+//
+//   An operand in memory is loaded into a scratch register, $t1-$t3,
+//   $a0 or $a1, which the allocator never hands out.  The blocks are
+//   laid out in the allocator's order, so blocks that cannot be reached
+//   are dropped.
+//
+//   A leaf, a function that calls nothing and needs neither frame slots
+//   nor $s registers, gets no frame at all.  $fp, $s0 and $ra are left
+//   alone, the arguments are addressed from $sp, and self is kept in
+//   $a0.  Getters, setters and arithmetic on formals are leaves.
+//
+//*****************************************************************
+
+struct LowerContext
+{
+	IrFunction &f;
+	MipsCode &s;
+	RegAlloc &ra;
+	std::vector<int> home;      // frame offset of every temporary
+	std::vector<int> label;     // label of every block
+	int slots;                  // frame slots of the temporaries
+	int k;                      // number of the current instruction
+	std::vector<char> clean;    // temporaries whose slot holds their register
+	int entry;                  // label after the prologue
+	int abort[2];               // labels of the void aborts, by IR_VOID_DISPATCH and IR_VOID_CASE
+	bool leaf;                  // no frame
+	const char *frame;          // register home offsets are from: $fp, or $sp in a leaf
+
+	LowerContext(IrFunction &fn, MipsCode &code, RegAlloc &r) :
+		f(fn), s(code), ra(r), slots(0), k(0), clean(fn.temps.size(), 0), entry(generate_label()),
+		leaf(false), frame(FP)
+	{
+		abort[IR_VOID_DISPATCH] = abort[IR_VOID_CASE] = -1;
+	}
+
+	const char *reg(int t) const { return mips_reg_name(ra.reg[t]); }
+	bool in_reg(int t) const { return ra.reg[t] >= 0; }
+};
+
+// The register holding temporary t, loaded into scratch if needed.
+static const char *lower_use(LowerContext &c, int t, const char *scratch)
+{
+	if (t == c.f.self()) return c.leaf ? ACC : SELF;
+	if (c.in_reg(t)) return c.reg(t);
+	emit_load(scratch, c.home[t], c.frame, c.s);
+	return scratch;
+}
+
+// Temporary t in exactly the register r.
+static void lower_use_in(LowerContext &c, int t, const char *r)
+{
+	const char *from = lower_use(c, t, r);
+	if (from != r) emit_move(r, from, c.s);
+}
+
+// The register to compute temporary t in, scratch if t is in memory.
+static const char *lower_target(LowerContext &c, int t, const char *scratch)
+{
+	return c.in_reg(t) ? c.reg(t) : scratch;
+}
+
+// Completes the definition of t computed in r.
+static void lower_def(LowerContext &c, int t, const char *r)
+{
+	c.clean[t] = 0;
+	if (!c.in_reg(t)) emit_store(r, c.home[t], c.frame, c.s);
+	else if (strcmp(r, c.reg(t)) != 0) emit_move(c.reg(t), r, c.s);
+}
+
+// Whether temporary t is saved around calls outside the frame: a raw
+// value, with a collector that would take it for a pointer there.  The
+// register allocator only saves those around calls into the runtime,
+// which never comes back into the program, so one area serves all.
+static bool saved_in_raw_area(IrFunction const& f, int t)
+{
+	return cgen_Memmgr != GC_NOGC && f.temps[t].kind != IK_OBJ;
+}
+
+// Stores the registers live across the call of the current instruction
+// to their frame slots, where the collector can see them, unless the
+// slot is known to be up to date, and the raw ones to raw_save.
+static void lower_save(LowerContext &c)
+{
+	int n = 0;
+	for (int t : c.ra.saves[c.k]){
+		if (saved_in_raw_area(c.f, t)){
+			if (n == 0) emit_load_address(T3, RAWSAVE, c.s);
+			emit_store(c.reg(t), n++, T3, c.s);
+			continue;
+		}
+		if (!c.clean[t]) emit_store(c.reg(t), c.home[t], FP, c.s);
+		c.clean[t] = 1;
+	}
+}
+
+static void lower_restore(LowerContext &c)
+{
+	int n = 0;
+	for (int t : c.ra.saves[c.k]){
+		if (saved_in_raw_area(c.f, t)){
+			if (n == 0) emit_load_address(T3, RAWSAVE, c.s);
+			emit_load(c.reg(t), n++, T3, c.s);
+		} else
+			emit_load(c.reg(t), c.home[t], FP, c.s);
+	}
+}
+
+static void lower_new(LowerContext &c, IrInstr const& i)
+{
+	MipsCode &s = c.s;
+	lower_save(c);
+	if (i.flags & IR_NO_INIT){
+		emit_new(i.sym, s);
+		lower_restore(c);
+		lower_def(c, i.dst, ACC);
+		return;
+	}
+	if (i.sym != SELF_TYPE){
+		emit_new(i.sym, s);
+		emit_push(ACC, s);
+		emit_move(SELF, ACC, s);
+		emit_jal_init(i.sym, s);
+	} else {
+		// object_Tab holds the protObj and init of every class by tag.
+		emit_load(T1, TAG_OFFSET, lower_use(c, i.a, T1), s);
+		emit_sll(T1, T1, 3, s);
+		emit_load_address(T2, "object_Tab", s);
+		emit_addu(T2, T1, T2, s);
+		emit_load(ACC, 0, T2, s);
+		emit_jal("Object.copy", s);
+		emit_push(ACC, s);
+		emit_move(SELF, ACC, s);
+		emit_load(T1, TAG_OFFSET, SELF, s);
+		emit_sll(T1, T1, 3, s);
+		emit_load_address(T2, "object_Tab", s);
+		emit_addu(T2, T1, T2, s);
+		emit_load(T2, 1, T2, s);
+		emit_jalr(T2, s);
+	}
+	// Class_init leaves $a0 undefined and restores the $s0 it was
+	// entered with, the new object.
+	emit_load(ACC, 1, SP, s);
+	emit_addiu(SP, SP, 4, s);
+	emit_load(SELF, c.home[c.f.self()], FP, s);
+	lower_restore(c);
+	lower_def(c, i.dst, ACC);
+}
+
+static void lower_call(LowerContext &c, IrInstr const& i)
+{
+	MipsCode &s = c.s;
+	int n = i.args.size();
+
+	lower_save(c);
+	emit_addiu(SP, SP, -4 * (n + 1), s);
+	for (int k = 0; k < n; k++)
+		emit_store(lower_use(c, i.args[k], T1), k + 1, SP, s);
+	lower_use_in(c, i.a, ACC);
+	emit_store(ACC, n + 1, SP, s);
+
+	if (i.flags & IR_DIRECT){
+		emit_jal_method(i.sym, i.sym2, s);
+	} else {
+		if (i.flags & IR_STATIC) s.ref(M_LA, T1, MipsRef::disptab(i.sym));
+		else emit_load(T1, DISPTABLE_OFFSET, ACC, s);
+		emit_load(T2, i.imm, T1, s);
+		emit_jalr(T2, s);
+	}
+
+	// The callee pops the arguments, self is left.
+	emit_addiu(SP, SP, 4, s);
+	lower_restore(c);
+	lower_def(c, i.dst, ACC);
+}
+
+static void lower_restore_callee_saved(LowerContext &c)
+{
+	for (size_t n = 0; n < c.ra.callee_saved.size(); n++)
+		emit_load(mips_reg_name(c.ra.callee_saved[n]), -1 - c.slots - n, FP, c.s);
+}
+
+//
+// A tail call reuses the frame.  A call of the function itself stores
+// the arguments and self over its own and jumps back to the start of
+// the body.  Any other call returns straight to our caller: the frame
+// is popped as on return, the callee's self and arguments are moved up
+// to where ours were, and the callee is jumped to.  The arguments are
+// first pushed as for a call, since our frame slots and arguments may
+// be among them.  Either way the stack does not grow.
+//
+static void lower_tail_call(LowerContext &c, IrInstr const& i)
+{
+	MipsCode &s = c.s;
+	int n = i.args.size();
+	bool self_call = (i.flags & IR_DIRECT) && i.sym == c.f.cls && i.sym2 == c.f.name;
+
+	// Unless an argument is one of our own read from its slot, the
+	// arguments of a self call can go straight to their slots.
+	bool direct = self_call;
+	for (int t : i.args)
+		if (c.f.is_formal(t) && !c.in_reg(t)) direct = false;
+	if (direct){
+		for (int k = 0; k < n; k++)
+			emit_store(lower_use(c, i.args[k], T1), 3 + k, FP, s);
+		emit_store(lower_use(c, i.a, T1), 3 + n, FP, s);
+		emit_branch(c.entry, s);
+		return;
+	}
+
+	emit_addiu(SP, SP, -4 * (n + 1), s);
+	for (int k = 0; k < n; k++)
+		emit_store(lower_use(c, i.args[k], T1), k + 1, SP, s);
+	lower_use_in(c, i.a, ACC);
+	emit_store(ACC, n + 1, SP, s);
+
+	if (self_call){
+		for (int k = 0; k <= n; k++){
+			emit_load(T1, k + 1, SP, s);
+			emit_store(T1, 3 + k, FP, s);
+		}
+		emit_addiu(SP, SP, 4 * (n + 1), s);
+		emit_branch(c.entry, s);
+		return;
+	}
+
+	if (!(i.flags & IR_DIRECT)){
+		if (i.flags & IR_STATIC) s.ref(M_LA, T1, MipsRef::disptab(i.sym));
+		else emit_load(T1, DISPTABLE_OFFSET, ACC, s);
+		emit_load(T2, i.imm, T1, s);
+	}
+	lower_restore_callee_saved(c);
+	emit_addiu(T3, FP, 4 * (3 + c.f.nformals), s);
+	emit_load(RA, 0, FP, s);
+	emit_load(SELF, 1, FP, s);
+	emit_load(FP, 2, FP, s);
+	for (int k = n; k >= 0; k--){
+		emit_load(T1, k + 1, SP, s);
+		emit_store(T1, k - n, T3, s);
+	}
+	emit_addiu(SP, T3, -4 * (n + 1), s);
+	if (i.flags & IR_DIRECT) emit_jump_method(i.sym, i.sym2, s);
+	else emit_jr(T2, s);
+}
+
+static void lower_return(LowerContext &c, IrInstr const& i)
+{
+	lower_use_in(c, i.a, ACC);
+	if (c.leaf){
+		emit_addiu(SP, SP, 4 * c.f.nformals, c.s);
+		emit_return(c.s);
+		return;
+	}
+	lower_restore_callee_saved(c);
+	emit_function_trailer(c.s, 3 + c.f.nformals, c.slots + c.ra.callee_saved.size());
+}
+
+static void lower_instr(LowerContext &c, IrBlock const& b, IrInstr const& i)
+{
+	MipsCode &s = c.s;
+	const char *x, *y, *d;
+	int l;
+
+	switch (i.op){
+	case IR_CONST:
+		d = lower_target(c, i.dst, T1);
+		s.ref(M_LA, d, i.ref);
+		lower_def(c, i.dst, d);
+		break;
+	case IR_IMM:
+		d = lower_target(c, i.dst, T1);
+		emit_load_imm(d, i.imm, s);
+		lower_def(c, i.dst, d);
+		break;
+	case IR_COPY:
+		lower_def(c, i.dst, lower_use(c, i.a, T1));
+		break;
+	case IR_GETATTR:
+		x = lower_use(c, i.a, T1);
+		d = lower_target(c, i.dst, T1);
+		emit_load(d, i.imm, x, s);
+		lower_def(c, i.dst, d);
+		break;
+	case IR_SETATTR:
+		x = lower_use(c, i.a, T1);
+		emit_store(lower_use(c, i.b, T2), i.imm, x, s);
+		if (!(i.flags & IR_NO_BARRIER)){
+			lower_save(c);
+			emit_write_barrier(x, i.imm, s);
+			lower_restore(c);
+		}
+		break;
+	case IR_UNBOX:
+		x = lower_use(c, i.a, T1);
+		d = lower_target(c, i.dst, T1);
+		emit_fetch_int(d, x, s);
+		lower_def(c, i.dst, d);
+		break;
+	case IR_BOX:
+		if (i.sym == Int){
+			// Registers are only clobbered, and restored, on the way
+			// through the allocator.
+			int alloc = generate_label(), done = generate_label();
+			lower_save(c);
+			emit_int_cache(lower_use(c, i.a, T1), alloc, s);
+			emit_branch(done, s);
+			emit_label_def(alloc, s);
+			emit_new(Int, s, DEFAULT_OBJFIELDS);
+			lower_restore(c);
+			emit_store_int(lower_use(c, i.a, T1), ACC, s);
+			emit_label_def(done, s);
+			lower_def(c, i.dst, ACC);
+		} else {
+			// Not in $a0, which holds self in a leaf.
+			l = generate_label();
+			x = lower_use(c, i.a, T1);
+			emit_load_bool(T2, falsebool, s);
+			emit_beqz(x, l, s);
+			emit_load_bool(T2, truebool, s);
+			emit_label_def(l, s);
+			lower_def(c, i.dst, T2);
+		}
+		break;
+	case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV:
+		x = lower_use(c, i.a, T1);
+		y = lower_use(c, i.b, T2);
+		d = lower_target(c, i.dst, T1);
+		if (i.op == IR_ADD) emit_add(d, x, y, s);
+		else if (i.op == IR_SUB) emit_sub(d, x, y, s);
+		else if (i.op == IR_MUL) emit_mul(d, x, y, s);
+		else emit_div(d, x, y, s);
+		lower_def(c, i.dst, d);
+		break;
+	case IR_NEG:
+		x = lower_use(c, i.a, T1);
+		d = lower_target(c, i.dst, T1);
+		emit_neg(d, x, s);
+		lower_def(c, i.dst, d);
+		break;
+	case IR_LT: case IR_LE: case IR_EQ:
+		l = generate_label();
+		x = lower_use(c, i.a, T1);
+		y = lower_use(c, i.b, T2);
+		emit_load_imm(T3, 1, s);
+		emit_cmp(i.op == IR_LT ? M_BLT : i.op == IR_LE ? M_BLE : M_BEQ, x, y, l, s);
+		emit_load_imm(T3, 0, s);
+		emit_label_def(l, s);
+		lower_def(c, i.dst, T3);
+		break;
+	case IR_NOT:
+		x = lower_use(c, i.a, T1);
+		d = lower_target(c, i.dst, T1);
+		emit_load_imm(T2, 1, s);
+		emit_sub(d, T2, x, s);
+		lower_def(c, i.dst, d);
+		break;
+	case IR_ISVOID:
+		l = generate_label();
+		x = lower_use(c, i.a, T1);
+		emit_load_imm(T3, 1, s);
+		emit_beqz(x, l, s);
+		emit_load_imm(T3, 0, s);
+		emit_label_def(l, s);
+		lower_def(c, i.dst, T3);
+		break;
+	case IR_EQUALS:
+		l = generate_label();
+		lower_save(c);
+		lower_use_in(c, i.a, T1);
+		lower_use_in(c, i.b, T2);
+		emit_load_bool(ACC, truebool, s);
+		emit_beq(T1, T2, l, s);
+		emit_load_bool(A1, falsebool, s);
+		emit_jal("equality_test", s);
+		emit_label_def(l, s);
+		lower_restore(c);
+		lower_def(c, i.dst, ACC);
+		break;
+	case IR_NEW:
+		lower_new(c, i);
+		break;
+	case IR_CHECK_VOID:
+		// To the abort after the body, which all checks share.
+		if (c.abort[i.imm] < 0) c.abort[i.imm] = generate_label();
+		emit_beqz(lower_use(c, i.a, T1), c.abort[i.imm], s);
+		break;
+	case IR_CALL:
+		if (i.flags & IR_TAIL) lower_tail_call(c, i);
+		else lower_call(c, i);
+		break;
+	case IR_TAG:
+		x = lower_use(c, i.a, T1);
+		d = lower_target(c, i.dst, T1);
+		emit_load(d, TAG_OFFSET, x, s);
+		lower_def(c, i.dst, d);
+		break;
+	case IR_JUMP:
+		emit_branch(c.label[b.succ[0]], s);
+		break;
+	case IR_BRANCH:
+		x = lower_use(c, i.a, T1);
+		l = c.label[b.succ[0]];
+		if (i.imm == IR_IF_NZ) emit_bnez(x, l, s);
+		else if (i.imm == IR_IF_Z) emit_beqz(x, l, s);
+		else {
+			y = lower_use(c, i.b, T2);
+			emit_cmp(i.imm == IR_IF_LT ? M_BLT : i.imm == IR_IF_LE ? M_BLE : M_BEQ, x, y, l, s);
+		}
+		emit_branch(c.label[b.succ[1]], s);
+		break;
+	case IR_RETURN:
+		// After a tail call there is nothing left to do.
+		if (!(i.flags & IR_TAIL)) lower_return(c, i);
+		break;
+	case IR_CASE_ABORT:
+		lower_use_in(c, i.a, ACC);
+		emit_jal("_case_abort", s);
+		break;
+	}
+}
+
+static void lower_function(IrFunction &f, MipsCode &s, ostream &out)
+{
+	f.propagate_copies();
+	replace_scalars(f);
+	simplify_boxes(f);
+	f.propagate_copies();
+	f.remove_void_checks();
+	f.elide_write_barriers(cgen_Memmgr == GC_GENGC);
+	f.remove_dead_code();
+	f.fuse_branches();
+	f.mark_tail_calls();
+	IrLiveness live(f);
+	RegAlloc ra(f, live, cgen_Memmgr != GC_NOGC);
+
+	// A boxed temporary is never raw again, and the raw ones boxing
+	// adds live across no method call, so this ends.  The boxes
+	// allocate, so the barriers are decided again.
+	while (!ra.unsafe.empty()){
+		box_temps(f, ra.unsafe);
+		f.elide_write_barriers(cgen_Memmgr == GC_GENGC);
+		live = IrLiveness(f);
+		ra = RegAlloc(f, live, cgen_Memmgr != GC_NOGC);
+	}
+	LowerContext c(f, s, ra);
+
+	// Slots for the temporaries that are spilled or saved around calls.
+	std::vector<char> saved(f.temps.size(), 0);
+	for (auto const& v : ra.saves)
+		for (int t : v) saved[t] = 1;
+	c.home.resize(f.temps.size(), 0);
+	for (size_t t = 1; t < f.temps.size(); t++)
+		if (!f.is_formal(t) && ra.start[t] >= 0 &&
+				(ra.reg[t] < 0 || (saved[t] && !saved_in_raw_area(f, t))))
+			c.home[t] = -1 - c.slots++;
+
+	bool uses_self = false;
+	c.leaf = c.slots == 0 && ra.callee_saved.empty();
+	for (auto const& b : f.blocks)
+		for (auto const& i : b.code){
+			if (i.calls()) c.leaf = false;
+			i.for_each_use([&](int t){ if (t == f.self()) uses_self = true; });
+		}
+
+	// Above the frame, or with no frame straight above the return point:
+	// the formals, then self.
+	int args = c.leaf ? 1 : 3;
+	if (c.leaf) c.frame = SP;
+	c.home[f.self()] = args + f.nformals;
+	for (int t = 1; t <= f.nformals; t++) c.home[t] = args + t - 1;
+
+	for (auto const& r : f.remarks) out << "# " << r << '\n';
+	if (cgen_debug){
+		f.dump(out);
+		out << "# registers:";
+		for (size_t t = 1; t < f.temps.size(); t++)
+			if (ra.start[t] >= 0)
+				out << " t" << t << "=" << (ra.reg[t] >= 0 ? mips_reg_name(ra.reg[t]) : "mem");
+		out << '\n';
+	}
+
+	c.label.resize(f.blocks.size());
+	for (auto &l : c.label) l = generate_label();
+
+	if (c.leaf){
+		if (uses_self) emit_load(ACC, c.home[f.self()], SP, s);
+	} else {
+		emit_function_header(s, c.slots + ra.callee_saved.size());
+		for (size_t n = 0; n < ra.callee_saved.size(); n++)
+			emit_store(mips_reg_name(ra.callee_saved[n]), -1 - c.slots - n, FP, s);
+		emit_label_def(c.entry, s);
+		emit_load(SELF, c.home[f.self()], FP, s);
+	}
+	live.in[ra.order[0]].for_each([&](int t){
+		if (f.is_formal(t) && c.in_reg(t)) emit_load(c.reg(t), c.home[t], c.frame, s);
+	});
+
+	for (int b : ra.order){
+		emit_label_def(c.label[b], s);
+		std::fill(c.clean.begin(), c.clean.end(), 0);
+		for (auto const& i : f.blocks[b].code){
+			lower_instr(c, f.blocks[b], i);
+			c.k++;
+		}
+	}
+
+	for (int kind : { IR_VOID_DISPATCH, IR_VOID_CASE }){
+		if (c.abort[kind] < 0) continue;
+		emit_label_def(c.abort[kind], s);
+		emit_load_address(ACC, "str_const0", s);
+		emit_load_imm(T1, 1, s);
+		emit_jal(kind == IR_VOID_CASE ? "_case_abort2" : "_dispatch_abort", s);
+	}
 }
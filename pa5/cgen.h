@@ -3,7 +3,9 @@
 #include "emit.h"
 #include "cool-tree.h"
 #include "symtab.h"
+#include "../common/scoped-symtab.h"
 #include <map>
+#include <vector>
 #include <functional>
 
 enum Basicness     {Basic, NotBasic};
@@ -23,19 +25,75 @@ struct StorageInfo
 {
 	char  *  reg;
 	int offset;
-	bool isTemp;
+	int local;    // index in ResolveContext::locals of a let/case binding, -1 otherwise
+	bool assigned;    // some assignment writes the variable
+	bool attribute;    // an attribute of self, offset words into the object
 
 	void emit(ostream& ss);
-	StorageInfo(char *r, int o, bool istemp = false):reg(r), offset(o), isTemp(istemp){}
+	StorageInfo(char *r, int o, int l = -1):reg(r), offset(o), local(l), assigned(false), attribute(false){}
 };
 
-typedef std::map<Symbol, StorageInfo *> Storage;
+//
+// Live range of a let/case binding, in program points of the resolve
+// walk over the enclosing method or Class_init.
+//
+struct FrameLocal
+{
+	StorageInfo *info;
+	int start, end;
+};
+
+//
+// Carried through the resolve pass that runs before code generation.
+// Every object reference, assignment and let/case binding is annotated
+// with its StorageInfo, and every dispatch with its table slot, so the
+// code() methods never have to search a map.  One context walks the
+// whole inheritance tree: the attributes of a class are bound in a
+// scope that stays open while its subclasses are resolved.
+//
+// It also lays out the frame of each function: the live ranges of its
+// let/case bindings are collected during the walk and colored onto the
+// fewest frame slots by end_frame().
+//
+struct ResolveContext
+{
+	Symbol classname;
+	ScopedSymbolTable<Symbol, StorageInfo> env;
+	int base;                          // $fp offset of frame slot 0
+	int clock;                         // current program point
+	std::vector<FrameLocal> locals;    // bindings of the current frame
+	std::vector<int> scope;            // locals currently in scope
+	int dispatches, devirtualized;     // dynamic dispatch sites, and those made direct
+
+	ResolveContext(Symbol c): classname(c), base(0), clock(0), dispatches(0), devirtualized(0) {}
+
+	void begin_frame(int b);
+	int end_frame();
+	StorageInfo *bind(Symbol name);
+	void unbind();
+	void use(StorageInfo *info);
+	int begin_loop() { return clock; }
+	void end_loop(int start);
+};
+
+//
+// Carried through the constant folding pass (-O), which runs after the
+// resolve pass: the constant value of every let binding that is
+// initialized with a constant and never assigned, and the number of
+// nodes folded.
+//
+struct FoldContext
+{
+	std::map<StorageInfo *, Expression> constants;
+	int folded;
+
+	FoldContext(): folded(0) {}
+};
 
 std::map<Symbol, std::map<Symbol, int> > dispatchTable;
-std::map<Symbol, std::map<Symbol, int> > tempTable;
 std::map<Symbol, CgenNodeP> classTable;
 
-class CgenClassTable : public SymbolTable<Symbol,CgenNode> {
+class CgenClassTable : public ScopedSymbolTable<Symbol,CgenNode> {
 private:
 	std::map<Symbol, int> classTags;
 
@@ -59,7 +117,8 @@ private:
    void code_objinitializers();
    void code_objmethods();
 
-   void fill_class_storages();
+   void resolve(int *dispatches = NULL, int *devirtualized = NULL);
+   int fold();
 
 // The following creates an inheritance graph from
 // a list of classes.  The graph is implemented as
@@ -71,6 +130,7 @@ private:
    void install_classes(Classes cs);
    void build_inheritance_tree();
    void set_relations(CgenNodeP nd);
+   void number_classes();
 
 public:
    CgenClassTable(Classes, ostream& str);
@@ -86,14 +146,14 @@ private:
    List<CgenNode> *children;                  // Children of class
    Basicness basic_status;                    // `Basic' if class is basic
                                               // `NotBasic' otherwise
-   Storage storage;
    int classTag;
+   int lastTag;                               // largest tag of the subclasses
+   int init_slots;                            // let/case slots of Class_init
 
 public:
 
-   void initialize_attributes(ostream& ss);
+   void initialize_attributes(ostream& ss, bool& unread);
    int getNumAttributes();
-   Storage& getStorage(){return storage;}
 
    CgenNode(Class_ c,
             Basicness bstatus, int classTag,
@@ -105,14 +165,17 @@ public:
    CgenNodeP get_parentnd() { return parentnd; }
    int basic() { return (basic_status == Basic); }
    int tag(){ return classTag; }
+   int last_tag(){ return lastTag; }
+   void number(int &next);
    void code_prototype(ostream& ss);
    void code_dispatchtable(std::map<Symbol, Symbol> &methodList, Symbol classname, ostream& ss);
    void code_init(ostream& ss);
    void code_init_recursive(ostream& ss, int& n);
-   void fill_storage_recursive(Storage &storage, int &n);
+   void code_flat_init(MipsCode& ss, bool& dirty, bool& young);
+   bool has_init();
+   int flat_init_slots();
+   void resolve(ResolveContext &ctx, int n);
    void code_methods(ostream& ss);
-   void count_temporaries(Symbol className);
-   int init_temporaries_recursive();
 };
 
 class BoolConst 
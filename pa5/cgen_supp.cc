@@ -39,7 +39,7 @@ void emit_string_constant(ostream& str, char* s)
       break;
     case '\\':
       byte_mode(str);
-      str << "\t.byte\t" << (int) ((unsigned char) '\\') << endl;
+      str << "\t.byte\t" << (int) ((unsigned char) '\\') << '\n';
       break;
     case '"' :
       ascii_mode(str);
@@ -54,14 +54,14 @@ void emit_string_constant(ostream& str, char* s)
       else 
 	{
 	  byte_mode(str);
-	  str << "\t.byte\t" << (int) ((unsigned char) *s) << endl;
+	  str << "\t.byte\t" << (int) ((unsigned char) *s) << '\n';
 	}
       break;
     }
     s++;
   }
   byte_mode(str);
-  str << "\t.byte\t0\t" << endl;
+  str << "\t.byte\t0\t\n";
 }
 
 
@@ -13,7 +13,10 @@
 #include "cool-tree.handcode.h"
 #include <map>
 struct StorageInfo;
-typedef std::map<Symbol, StorageInfo *> Storage;
+class MipsCode;
+struct IrBuilder;
+struct ResolveContext;
+struct FoldContext;
 typedef std::map<Symbol, int> DispatchTable;
 
 // define the class for phylum
@@ -54,13 +57,16 @@ public:
    virtual Feature copy_Feature() = 0;
    virtual Symbol get_name() = 0;
    virtual void incrementForAttrs(int& counter){}
-   virtual void initialize_attribute(ostream& ss){}
-   virtual void init_single_attr(Storage &storage, ostream& ss, int& n){ }
-   virtual void fill_storage(Storage &storage, int& n){ }
+   virtual void initialize_attribute(ostream& ss, bool& unread){}
+   virtual void init_single_attr(MipsCode& ss){ }
+   virtual void init_flat_attr(MipsCode& ss, Symbol cls, bool& dirty, bool& young){ }
+   virtual bool has_init(){ return false; }
+   virtual void bind_attribute(ResolveContext &ctx, int& n){ }
    virtual void code_dispatchtableentry(std::map<Symbol, Symbol>& methodList, std::map<Symbol, int>& dispatchTable, int& k, ostream& ss) { }
-   virtual void code_method(Symbol classname, Storage& storage, ostream& s){}
-   virtual void count_temporaries(std::map<Symbol, int>& classname){ }
-   virtual int init_temps(){ return 0; }
+   virtual void code_method(Symbol classname, ostream& s){}
+   virtual void resolve(ResolveContext &ctx){ }
+   virtual void resolve_init(ResolveContext &ctx){ }
+   virtual void fold(FoldContext &ctx){ }
    virtual void override(std::map<Symbol, Symbol>& methodList, Symbol classname){}
 
 #ifdef Feature_EXTRAS
@@ -91,7 +97,6 @@ class Expression_class : public tree_node {
 public:
    tree_node *copy()		 { return copy_Expression(); }
    virtual Expression copy_Expression() = 0;
-   virtual int  count_temporaries(){ return 0;}
 
 #ifdef Expression_EXTRAS
    Expression_EXTRAS
@@ -106,8 +111,9 @@ class Case_class : public tree_node {
 public:
    tree_node *copy()		 { return copy_Case(); }
    virtual Case copy_Case() = 0;
-   virtual int count_temporaries() = 0;
-   virtual  void code(Storage &s, ostream &ss) = 0;
+   virtual  void code(MipsCode &ss) = 0;
+   virtual  void resolve(ResolveContext &ctx) = 0;
+   virtual  void fold(FoldContext &ctx) = 0;
    virtual  Symbol get_id() = 0;
    virtual Symbol get_type() = 0;
 
@@ -197,21 +203,22 @@ public:
    Formals formals;
    Symbol return_type;
    Expression expr;
+   int frame_slots;           // let/case slots in the frame of the method
 public:
    method_class(Symbol a1, Formals a2, Symbol a3, Expression a4) {
       name = a1;
       formals = a2;
       return_type = a3;
       expr = a4;
+      frame_slots = 0;
    }
    Symbol get_name(){return name;}
    Feature copy_Feature();
    void dump(ostream& stream, int n);
    void code_dispatchtableentry(std::map<Symbol, Symbol> &methodList, std::map<Symbol, int> &dispatchTable, int& k, ostream &ss);
-   void code_method(Symbol classname, Storage &storage, ostream& s);
-   void count_temporaries(std::map<Symbol, int>& tempTable) {
-	   tempTable[name] = expr->count_temporaries();
-   }
+   void code_method(Symbol classname, ostream& s);
+   void resolve(ResolveContext &ctx);
+   void fold(FoldContext &ctx);
 
    void override(std::map<Symbol, Symbol> & methodList, Symbol classname);
 
@@ -230,18 +237,24 @@ public:
    Symbol name;
    Symbol type_decl;
    Expression init;
+   StorageInfo *loc;          // offset of the attribute in the object
+   bool in_prototype;         // init is a constant held by the protObj, with -O
 public:
    attr_class(Symbol a1, Symbol a2, Expression a3) {
       name = a1;
       type_decl = a2;
       init = a3;
+      loc = NULL;
+      in_prototype = false;
    }
    void incrementForAttrs(int& counter){counter++;}
-   void initialize_attribute(ostream& ss);
-   void init_single_attr(Storage &storage, std::ostream& ss, int& n);
-   void fill_storage(Storage& storage, int& n);
-   int init_temps() { return init->count_temporaries(); }
-
+   void initialize_attribute(ostream& ss, bool& unread);
+   void init_single_attr(MipsCode& ss);
+   void init_flat_attr(MipsCode& ss, Symbol cls, bool& dirty, bool& young);
+   bool has_init();
+   void bind_attribute(ResolveContext &ctx, int& n);
+   void resolve_init(ResolveContext &ctx);
+   void fold(FoldContext &ctx);
 
    Symbol get_name(){return name;}
    Feature copy_Feature();
@@ -285,21 +298,22 @@ public:
    Symbol name;
    Symbol type_decl;
    Expression expr;
+   StorageInfo *loc;          // frame slot of the bound identifier
 public:
    branch_class(Symbol a1, Symbol a2, Expression a3) {
       name = a1;
       type_decl = a2;
       expr = a3;
+      loc = NULL;
    }
    Case copy_Case();
    void dump(ostream& stream, int n);
-   int count_temporaries(){
-	   return expr->count_temporaries();
-   }
 
-   void code(Storage &s, ostream &ss){
-	   expr->code(s, ss);
+   void code(MipsCode &ss){
+	   expr->code(ss);
    }
+   void resolve(ResolveContext &ctx);
+   void fold(FoldContext &ctx);
 
    Symbol get_id(){ return name; }
    Symbol get_type() { return type_decl; }
@@ -317,14 +331,15 @@ class assign_class : public Expression_class {
 public:
    Symbol name;
    Expression expr;
+   StorageInfo *loc;          // resolved location of `name'
 public:
    assign_class(Symbol a1, Expression a2) {
       name = a1;
       expr = a2;
+      loc = NULL;
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
-   int count_temporaries(){return expr->count_temporaries();}
 
 
 #ifdef Expression_SHARED_EXTRAS
@@ -343,16 +358,19 @@ public:
    Symbol type_name;
    Symbol name;
    Expressions actual;
+   int slot;                  // dispatch table index of `name' in type_name
+   Symbol target;             // class whose `name' is called (-O), or NULL
 public:
    static_dispatch_class(Expression a1, Symbol a2, Symbol a3, Expressions a4) {
       expr = a1;
       type_name = a2;
       name = a3;
       actual = a4;
+      slot = -1;
+      target = NULL;
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
-   int count_temporaries(){return expr->count_temporaries();}
 
 
 #ifdef Expression_SHARED_EXTRAS
@@ -370,15 +388,18 @@ public:
    Expression expr;
    Symbol name;
    Expressions actual;
+   int slot;                  // dispatch table index of `name' in the static type
+   Symbol target;             // class whose `name' is always called (-O), or NULL
 public:
    dispatch_class(Expression a1, Symbol a2, Expressions a3) {
       expr = a1;
       name = a2;
       actual = a3;
+      slot = -1;
+      target = NULL;
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
-   int count_temporaries(){return expr->count_temporaries();}
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -403,7 +424,6 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
-   int count_temporaries(){ return std::max(std::max(pred->count_temporaries(), then_exp->count_temporaries()), else_exp->count_temporaries());}
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -426,7 +446,6 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
-   int count_temporaries(){return std::max(pred->count_temporaries(), body->count_temporaries());}
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -449,14 +468,6 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
-   int count_temporaries(){
-	   int t = 0;
-	   for(int i = cases->first(); cases->more(i); i = cases->next(i)){
-		   int tt = cases->nth(i)->count_temporaries();
-		   if (tt>t) t = tt;
-	   }
-	   return t+1;
-   }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -477,13 +488,6 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
-   int count_temporaries(){
-	   int t = 0;
-	   for (int i = body->first(); body->more(i); i = body->next(i)){
-		   t += body->nth(i)->count_temporaries();
-	   }
-	   return t;
-   }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -501,18 +505,17 @@ public:
    Symbol type_decl;
    Expression init;
    Expression body;
+   StorageInfo *loc;          // frame slot of the bound identifier
 public:
    let_class(Symbol a1, Symbol a2, Expression a3, Expression a4) {
       identifier = a1;
       type_decl = a2;
       init = a3;
       body = a4;
+      loc = NULL;
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
-   int count_temporaries(){
-	   return 1 + std::max(body->count_temporaries(), init->count_temporaries());
-   }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -839,9 +842,11 @@ public:
 class object_class : public Expression_class {
 public:
    Symbol name;
+   StorageInfo *loc;          // resolved location of `name'
 public:
    object_class(Symbol a1) {
       name = a1;
+      loc = NULL;
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
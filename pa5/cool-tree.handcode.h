@@ -96,13 +96,27 @@ void dump_with_types(ostream& ,int);
 Symbol type;                                 \
 Symbol get_type() { return type; }           \
 Expression set_type(Symbol s) { type = s; return this; } \
-virtual void code(Storage &, ostream&) = 0; \
+virtual void code(MipsCode&) = 0; \
+virtual void code_branch(MipsCode&, int, bool); \
+virtual int build(IrBuilder &) = 0; \
+virtual void resolve(ResolveContext &) = 0; \
+virtual Expression fold(FoldContext &) = 0; \
 virtual void dump_with_types(ostream&,int) = 0;  \
 void dump_type(ostream&, int);               \
 Expression_class() { type = (Symbol) NULL; }
 
+#define lt_EXTRAS void code_branch(MipsCode&, int, bool);
+#define leq_EXTRAS void code_branch(MipsCode&, int, bool);
+#define eq_EXTRAS void code_branch(MipsCode&, int, bool);
+#define comp_EXTRAS void code_branch(MipsCode&, int, bool);
+#define isvoid_EXTRAS void code_branch(MipsCode&, int, bool);
+#define bool_const_EXTRAS void code_branch(MipsCode&, int, bool);
+
 #define Expression_SHARED_EXTRAS           \
-void code(Storage &, ostream&); 			   \
+void code(MipsCode&); 			   \
+int build(IrBuilder &);                    \
+void resolve(ResolveContext &);            \
+Expression fold(FoldContext &);            \
 void dump_with_types(ostream&,int);
 
 
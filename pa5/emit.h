@@ -35,6 +35,8 @@
 #define INTCONST_PREFIX      "int_const"
 #define STRCONST_PREFIX      "str_const"
 #define BOOLCONST_PREFIX     "bool_const"
+#define INTCACHE             "int_cache"
+#define RAWSAVE              "raw_save"
 
 
 #define EMPTYSLOT            0
@@ -57,6 +59,10 @@
 #define INT_SLOTS         3
 #define BOOL_SLOTS        3
 
+// The preallocated Ints of -O, each an eyecatcher and 4 words.
+#define INT_CACHE_MIN     -128
+#define INT_CACHE_MAX     1023
+
 #define GLOBAL        "\t.globl\t"
 #define ALIGN         "\t.align\t2\n"
 #define WORD          "\t.word\t"
@@ -73,6 +79,8 @@
 #define T3   "$t3"		// Temporary 3 
 #define SP   "$sp"		// Stack pointer 
 #define FP   "$fp"		// Frame pointer 
+#define GP   "$gp"		// Heap pointer, next free word 
+#define LIMIT "$s7"		// End of the allocation area 
 
 #define RA   "$ra"		// Return address 
 
@@ -81,6 +89,8 @@
 //
 #define JALR  "\tjalr\t"  
 #define JAL   "\tjal\t"                 
+#define JUMP  "\tj\t"
+#define JR    "\tjr\t"
 #define RET   "\tjr\t" RA "\t"
 
 #define SW    "\tsw\t"
@@ -99,11 +109,13 @@
 #define SUB   "\tsub\t"
 #define SLL   "\tsll\t"
 #define BEQZ  "\tbeqz\t"
+#define BNEZ  "\tbnez\t"
 #define BRANCH   "\tb\t"
 #define BEQ      "\tbeq\t"
 #define BNE      "\tbne\t"
 #define BLEQ     "\tble\t"
 #define BLT      "\tblt\t"
 #define BGT      "\tbgt\t"
+#define BGE      "\tbge\t"
 
 
@@ -0,0 +1,39 @@
+-- Ints on either side of the ends of the preallocated range behave the
+-- same: -129, -128, 1023 and 1024 are computed at run time, printed,
+-- compared, matched by a case and given their type name.
+--
+-- Expected output:
+-- -129 -128 1023 1024
+-- Int Int Int Int
+-- 1 0 1
+-- Int
+
+
+class Main inherits IO
+{
+  show( n : Int ) : Object
+  {
+    case n of
+      i : Int => out_string( i.type_name() );
+      o : Object => out_string( "Object" );
+    esac
+  };
+
+  main() : Object
+  {
+    let lo : Int <- 0 - 129,
+        hi : Int <- 1000
+    in
+    {
+      while hi < 1024 loop hi <- hi + 1 pool;
+      out_int( lo ).out_string( " " ).out_int( lo + 1 ).out_string( " " );
+      out_int( hi - 1 ).out_string( " " ).out_int( hi ).out_string( "\n" );
+      show( lo ); out_string( " " ); show( lo + 1 ); out_string( " " );
+      show( hi - 1 ); out_string( " " ); show( hi ); out_string( "\n" );
+      out_int( if lo + 1 = 0 - 128 then 1 else 0 fi ).out_string( " " );
+      out_int( if hi - 1 = hi then 1 else 0 fi ).out_string( " " );
+      out_int( if hi - 1 = 1023 then 1 else 0 fi ).out_string( "\n" );
+      out_string( (hi - 1).copy().type_name() ).out_string( "\n" );
+    }
+  };
+};
@@ -0,0 +1,687 @@
+//
+// ir.h
+//
+// Three-address intermediate representation of a method body.
+//
+// With -O a method is not coded straight from the AST.  The build()
+// virtuals of the expression nodes translate the body into an
+// IrFunction, a control flow graph of basic blocks of three-address
+// instructions over an unbounded set of temporaries, which is then
+// lowered to MIPS by lower_function() in cgen.cc.  Without -O the
+// stack machine code() virtuals are used as before.
+//
+// Every temporary is typed.  IK_OBJ temporaries hold pointers to Cool
+// objects, and also record the static class of the value; IK_INT and
+// IK_BOOL hold raw machine integers that are never seen by the garbage
+// collector as objects.  Int and Bool values are computed and kept in
+// raw temporaries where possible, and BOX and UNBOX convert between the
+// two where an object is needed or an object is operated on.
+//
+// Temporaries are not in SSA form: a let or case variable, or a formal,
+// is a single temporary that every assignment to the variable writes.
+// Temporary 0 is self, temporaries 1..n the formals.
+//
+// Every block ends with exactly one terminator (IR_JUMP, IR_BRANCH,
+// IR_RETURN or IR_CASE_ABORT), which is the only instruction that
+// transfers control, apart from the aborts of IR_CHECK_VOID.  Block 0
+// is the entry.
+//
+// Include after cgen.h and mips-code.h.
+//
+
+#ifndef IR_H
+#define IR_H
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+enum IrOp {
+	IR_CONST,         // dst = address of a constant object (ref)
+	IR_IMM,           // dst = imm
+	IR_COPY,          // dst = a
+	IR_GETATTR,       // dst = attribute imm of object a
+	IR_SETATTR,       // attribute imm of object a = b
+	IR_UNBOX,         // dst = raw value of the Int or Bool object a
+	IR_BOX,           // dst = new object of class sym (Int or Bool) holding a,
+	                  // imm is the kind of a
+	IR_ADD, IR_SUB, IR_MUL, IR_DIV,   // dst = a op b
+	IR_NEG,           // dst = -a
+	IR_LT, IR_LE, IR_EQ,              // dst = a op b ? 1 : 0
+	IR_NOT,           // dst = a ? 0 : 1
+	IR_ISVOID,        // dst = a == void ? 1 : 0
+	IR_EQUALS,        // dst = bool object of the Cool `=' of basic objects a and b
+	IR_NEW,           // dst = new sym; for SELF_TYPE, of the class of a
+	IR_CHECK_VOID,    // abort if a is void; imm is IR_VOID_DISPATCH or IR_VOID_CASE
+	IR_CALL,          // dst = dispatch to method sym2 in slot imm of a with args;
+	                  // sym is the static class, or the class of a static dispatch,
+	                  // or with IR_DIRECT the class whose method is called
+	IR_TAG,           // dst = class tag of object a
+
+	// terminators
+	IR_JUMP,          // to succ[0]
+	IR_BRANCH,        // to succ[0] if condition imm holds of a (and b), else to succ[1]
+	IR_RETURN,        // return a
+	IR_CASE_ABORT     // no case branch matches object a
+};
+
+enum IrKind { IK_OBJ, IK_INT, IK_BOOL };
+
+enum { IR_VOID_DISPATCH, IR_VOID_CASE };
+
+// Conditions of an IR_BRANCH.
+enum { IR_IF_NZ, IR_IF_Z, IR_IF_LT, IR_IF_LE, IR_IF_EQ };
+
+// Flags of an IR_CALL: a static dispatch, and a call of the method of
+// class sym itself, with no table lookup.  IR_TAIL marks a call whose
+// result is returned at once, and the IR_RETURN after it.  IR_NO_INIT
+// marks an IR_NEW of a class with nothing to initialize, and
+// IR_NO_BARRIER an IR_SETATTR that needs no write barrier.
+enum { IR_STATIC = 1, IR_DIRECT = 2, IR_TAIL = 4, IR_NO_INIT = 8, IR_NO_BARRIER = 16 };
+
+struct IrTemp
+{
+	IrKind kind;
+	Symbol cls;       // static class of the value
+};
+
+struct IrInstr
+{
+	IrOp op;
+	int dst, a, b;    // temporaries, -1 when unused
+	int imm;
+	int flags;
+	Symbol sym, sym2;
+	MipsRef ref;
+	std::vector<int> args;
+
+	bool is_terminator() const { return op >= IR_JUMP; }
+
+	// Instructions that call into a method or the runtime and return,
+	// so that caller saved registers do not survive them and the
+	// collector may run.  The operand of a BOX is read after the call.
+	bool calls() const
+	{
+		return op == IR_CALL || op == IR_NEW || op == IR_EQUALS ||
+			(op == IR_SETATTR && !(flags & IR_NO_BARRIER)) ||
+			(op == IR_BOX && imm == IK_INT);
+	}
+
+	// Calls that may run methods of the program, rather than only the
+	// runtime: a dispatch, and a new that runs a Class_init.
+	bool runs_code() const
+	{
+		return op == IR_CALL || (op == IR_NEW && !(flags & IR_NO_INIT));
+	}
+
+	// Instructions that can be dropped when their result is not used.
+	// Division may trap; GETATTR is only applied to self or to a
+	// receiver checked for void.
+	bool pure() const
+	{
+		switch (op){
+		case IR_CONST: case IR_IMM: case IR_COPY: case IR_GETATTR:
+		case IR_UNBOX: case IR_BOX: case IR_ADD: case IR_SUB: case IR_MUL:
+		case IR_NEG: case IR_LT: case IR_LE: case IR_EQ: case IR_NOT:
+		case IR_ISVOID: case IR_EQUALS: case IR_TAG:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	template <class F> void for_each_use(F f) const
+	{
+		if (a >= 0) f(a);
+		if (b >= 0) f(b);
+		for (int t : args) f(t);
+	}
+};
+
+//
+// A set of temporaries.
+//
+class IrSet
+{
+	std::vector<unsigned long long> w;
+
+public:
+	IrSet(size_t n = 0) : w((n + 63) / 64, 0) {}
+
+	bool has(int t) const { return (w[t >> 6] >> (t & 63)) & 1; }
+	void add(int t) { w[t >> 6] |= 1ULL << (t & 63); }
+	void remove(int t) { w[t >> 6] &= ~(1ULL << (t & 63)); }
+	bool operator==(IrSet const& o) const { return w == o.w; }
+	bool operator!=(IrSet const& o) const { return w != o.w; }
+
+	void add_all(IrSet const& o)
+	{
+		for (size_t i = 0; i < w.size(); i++) w[i] |= o.w[i];
+	}
+
+	void keep_only(IrSet const& o)
+	{
+		for (size_t i = 0; i < w.size(); i++) w[i] &= o.w[i];
+	}
+
+	template <class F> void for_each(F f) const
+	{
+		for (size_t i = 0; i < w.size(); i++)
+			for (unsigned long long x = w[i]; x; x &= x - 1)
+				f((int) (i * 64 + __builtin_ctzll(x)));
+	}
+};
+
+struct IrBlock
+{
+	std::vector<IrInstr> code;
+	std::vector<int> succ, pred;
+};
+
+struct IrFunction
+{
+	Symbol cls, name;
+	int nformals;
+	std::vector<IrTemp> temps;
+	std::vector<IrBlock> blocks;
+	std::vector<std::string> remarks;     // inlining decisions, one per call site
+
+	IrFunction(Symbol c, Symbol n, int formals) : cls(c), name(n), nformals(formals) {}
+
+	int new_temp(IrKind kind, Symbol c = NULL)
+	{
+		IrTemp t = { kind, c };
+		temps.push_back(t);
+		return temps.size() - 1;
+	}
+
+	int new_block()
+	{
+		blocks.push_back(IrBlock());
+		return blocks.size() - 1;
+	}
+
+	int self() const { return 0; }
+	bool is_formal(int t) const { return t >= 1 && t <= nformals; }
+
+	void compute_preds();
+	std::vector<int> reverse_postorder() const;
+	bool remove_dead_code();
+	void propagate_copies();
+	void remove_void_checks();
+	void elide_write_barriers(bool generational);
+	void fuse_branches();
+	void mark_tail_calls();
+	void dump(std::ostream& s) const;
+
+private:
+	template <class F> std::vector<IrSet> must_forward(IrSet const& entry, F transfer) const;
+};
+
+//
+// Appends instructions to the current block of a function.  A block
+// is closed by its terminator, after which set_block() must select the
+// next block to fill.
+//
+struct IrBuilder
+{
+	IrFunction &f;
+	int cur;
+	std::map<StorageInfo *, int> locals;    // let/case binding -> temporary
+
+	// The method whose body is being built, which inside an inlined call
+	// is not f's own: its class and the temporaries of self and its
+	// formals.
+	Symbol cls;
+	int self;
+	std::vector<int> formals;
+
+	std::vector<std::pair<Symbol, Symbol> > inlining;    // methods being built, outermost first
+	bool inline_calls;
+
+	IrBuilder(IrFunction &fn, bool inl = true) :
+		f(fn), cur(fn.new_block()), cls(fn.cls), self(fn.self()), inline_calls(inl)
+	{
+		for (int t = 1; t <= fn.nformals; t++) formals.push_back(t);
+		inlining.push_back(std::make_pair(fn.cls, fn.name));
+	}
+
+	static IrInstr make(IrOp op, int dst = -1, int a = -1, int b = -1)
+	{
+		IrInstr i;
+		i.op = op;
+		i.dst = dst; i.a = a; i.b = b;
+		i.imm = 0;
+		i.flags = 0;
+		i.sym = i.sym2 = NULL;
+		i.ref.kind = MipsRef::NONE;
+		i.ref.a = i.ref.b = NULL;
+		return i;
+	}
+
+	IrInstr &emit(IrInstr const& i)
+	{
+		f.blocks[cur].code.push_back(i);
+		return f.blocks[cur].code.back();
+	}
+
+	// Appends `dst = op a, b' with a new temporary dst of the given kind.
+	int value(IrOp op, IrKind kind, Symbol cls, int a = -1, int b = -1)
+	{
+		int dst = f.new_temp(kind, cls);
+		emit(make(op, dst, a, b));
+		return dst;
+	}
+
+	int imm(int v, IrKind kind = IK_INT, Symbol cls = NULL)
+	{
+		int dst = f.new_temp(kind, cls);
+		emit(make(IR_IMM, dst)).imm = v;
+		return dst;
+	}
+
+	int constant(MipsRef r, Symbol cls)
+	{
+		int dst = f.new_temp(IK_OBJ, cls);
+		emit(make(IR_CONST, dst)).ref = r;
+		return dst;
+	}
+
+	void copy(int dst, int src) { emit(make(IR_COPY, dst, src)); }
+
+	void jump(int to)
+	{
+		emit(make(IR_JUMP));
+		f.blocks[cur].succ.push_back(to);
+	}
+
+	void branch(int cond, int t, int e)
+	{
+		emit(make(IR_BRANCH, -1, cond));
+		f.blocks[cur].succ.push_back(t);
+		f.blocks[cur].succ.push_back(e);
+	}
+
+	void set_block(int b) { cur = b; }
+};
+
+inline void IrFunction::compute_preds()
+{
+	for (auto &b : blocks) b.pred.clear();
+	for (size_t i = 0; i < blocks.size(); i++)
+		for (int s : blocks[i].succ)
+			blocks[s].pred.push_back(i);
+}
+
+// Blocks reachable from the entry, each before its successors except
+// along back edges.  The successors are visited last to first, so the
+// first successor of a branch, the then arm or the loop body, follows
+// it directly.
+inline std::vector<int> IrFunction::reverse_postorder() const
+{
+	std::vector<int> order;
+	std::vector<char> seen(blocks.size(), 0);
+	std::vector<std::pair<int, size_t> > stack;
+	stack.push_back(std::make_pair(0, (size_t) 0));
+	seen[0] = 1;
+	while (!stack.empty()){
+		int b = stack.back().first;
+		size_t &next = stack.back().second;
+		if (next < blocks[b].succ.size()){
+			int s = blocks[b].succ[blocks[b].succ.size() - 1 - next++];
+			if (!seen[s]){
+				seen[s] = 1;
+				stack.push_back(std::make_pair(s, (size_t) 0));
+			}
+		} else {
+			order.push_back(b);
+			stack.pop_back();
+		}
+	}
+	return std::vector<int>(order.rbegin(), order.rend());
+}
+
+//
+// Temporaries live at the start and end of every block, by the usual
+// backward dataflow iteration.
+//
+struct IrLiveness
+{
+	std::vector<IrSet> in, out;
+
+	IrLiveness(IrFunction const& f) :
+		in(f.blocks.size(), IrSet(f.temps.size())),
+		out(f.blocks.size(), IrSet(f.temps.size()))
+	{
+		std::vector<int> order = f.reverse_postorder();
+		bool changed = true;
+		while (changed){
+			changed = false;
+			for (size_t n = order.size(); n-- > 0; ){
+				int b = order[n];
+				IrSet live(f.temps.size());
+				for (int s : f.blocks[b].succ) live.add_all(in[s]);
+				out[b] = live;
+				transfer(f.blocks[b], live);
+				if (live != in[b]){
+					in[b] = live;
+					changed = true;
+				}
+			}
+		}
+	}
+
+	// Runs live backwards over the instructions of b.
+	static void transfer(IrBlock const& b, IrSet& live)
+	{
+		for (size_t k = b.code.size(); k-- > 0; ){
+			IrInstr const& i = b.code[k];
+			if (i.dst >= 0) live.remove(i.dst);
+			i.for_each_use([&](int t){ live.add(t); });
+		}
+	}
+};
+
+// Drops pure instructions whose results are never used.  Returns
+// whether anything was removed.
+inline bool IrFunction::remove_dead_code()
+{
+	bool any = false;
+	for (bool changed = true; changed; ){
+		changed = false;
+		IrLiveness live(*this);
+		for (size_t b = 0; b < blocks.size(); b++){
+			IrSet l = live.out[b];
+			std::vector<IrInstr> &code = blocks[b].code;
+			std::vector<IrInstr> kept;
+			for (size_t k = code.size(); k-- > 0; ){
+				IrInstr &i = code[k];
+				if (i.pure() && !l.has(i.dst)){
+					changed = true;
+					continue;
+				}
+				if (i.dst >= 0) l.remove(i.dst);
+				i.for_each_use([&](int t){ l.add(t); });
+				kept.push_back(i);
+			}
+			code.assign(kept.rbegin(), kept.rend());
+		}
+		any |= changed;
+	}
+	return any;
+}
+
+//
+// Within each block, replaces the uses of the destination of a copy by
+// its source, as long as neither is written again.  The copies that
+// take a snapshot of a variable are only needed when the variable is
+// assigned before the snapshot is used; the others are left dead.
+//
+inline void IrFunction::propagate_copies()
+{
+	std::vector<int> source(temps.size(), -1);
+	std::vector<std::vector<int> > copies(temps.size());    // copies of a temporary
+	std::vector<int> touched;
+
+	for (auto &b : blocks){
+		for (auto &i : b.code){
+			auto subst = [&](int &t){ if (t >= 0 && source[t] >= 0) t = source[t]; };
+			subst(i.a);
+			subst(i.b);
+			for (int &t : i.args) subst(t);
+
+			if (i.dst < 0) continue;
+			// Forget the copies i.dst was and the copies of i.dst.
+			if (source[i.dst] >= 0) source[i.dst] = -1;
+			for (int t : copies[i.dst])
+				if (source[t] == i.dst) source[t] = -1;
+			copies[i.dst].clear();
+
+			if (i.op == IR_COPY && i.a != i.dst){
+				source[i.dst] = i.a;
+				copies[i.a].push_back(i.dst);
+				touched.push_back(i.dst);
+				touched.push_back(i.a);
+			}
+		}
+		for (int t : touched){
+			source[t] = -1;
+			copies[t].clear();
+		}
+		touched.clear();
+	}
+}
+
+//
+// A forward must-analysis: the set of temporaries that holds at the
+// start of every block, given the set at the entry and the effect of an
+// instruction.  Over the blocks in reverse postorder, intersecting over
+// the predecessors done so far; a back edge can only remove temporaries.
+//
+template <class F>
+std::vector<IrSet> IrFunction::must_forward(IrSet const& entry, F transfer) const
+{
+	std::vector<int> order = reverse_postorder();
+	std::vector<IrSet> in(blocks.size(), entry), out(blocks.size(), entry);
+	std::vector<char> done(blocks.size(), 0);
+	for (bool changed = true; changed; ){
+		changed = false;
+		for (int b : order){
+			IrSet known = entry;
+			bool first = true;
+			for (int p : blocks[b].pred){
+				if (b == 0 || !done[p]) continue;
+				if (first) known = out[p];
+				else known.keep_only(out[p]);
+				first = false;
+			}
+			in[b] = known;
+			for (auto const& i : blocks[b].code) transfer(i, known);
+			if (!done[b] || known != out[b]){
+				out[b] = known;
+				done[b] = 1;
+				changed = true;
+			}
+		}
+	}
+	return in;
+}
+
+//
+// Drops the void checks of objects known not to be void on every path
+// to the check, and folds isvoid of them to false.  Self, constants,
+// new objects, boxed values and objects already checked are not void,
+// until the temporary holding them is written with anything else.
+//
+inline void IrFunction::remove_void_checks()
+{
+	auto transfer = [](IrInstr const& i, IrSet &known){
+		if (i.op == IR_CHECK_VOID) known.add(i.a);
+		if (i.dst < 0) return;
+		if (i.op == IR_CONST || i.op == IR_NEW || i.op == IR_BOX || i.op == IR_EQUALS ||
+		    (i.op == IR_COPY && known.has(i.a)))
+			known.add(i.dst);
+		else
+			known.remove(i.dst);
+	};
+
+	IrSet entry(temps.size());
+	entry.add(self());
+	std::vector<IrSet> in = must_forward(entry, transfer);
+
+	for (int b : reverse_postorder()){
+		IrSet known = in[b];
+		std::vector<IrInstr> kept;
+		for (auto &i : blocks[b].code){
+			bool redundant = i.op == IR_CHECK_VOID && known.has(i.a);
+			if (i.op == IR_ISVOID && known.has(i.a)){
+				i.op = IR_IMM;
+				i.a = -1;
+				i.imm = 0;
+			}
+			transfer(i, known);
+			if (!redundant) kept.push_back(i);
+		}
+		blocks[b].code.swap(kept);
+	}
+}
+
+//
+// The generational collector must hear of every store that may make an
+// old object point to a young one.  Stores of constants and void, which
+// are not in the heap, cannot, nor can stores into an object the
+// allocator returned with no call since, which is still young: only a
+// collection, in a call, makes objects old.  Without the generational
+// collector no store needs the barrier.
+//
+// Temporary t is young while t is in the set, and does not point into
+// the heap while n + t is.  Run again after a change, it starts over.
+//
+inline void IrFunction::elide_write_barriers(bool generational)
+{
+	for (auto &b : blocks)
+		for (auto &i : b.code) i.flags &= ~IR_NO_BARRIER;
+
+	int n = temps.size();
+	auto transfer = [n](IrInstr const& i, IrSet &known){
+		if (i.calls())
+			for (int t = 0; t < n; t++) known.remove(t);
+		if (i.dst < 0) return;
+		bool young = (i.op == IR_NEW && (i.flags & IR_NO_INIT)) ||
+			(i.op == IR_COPY && known.has(i.a));
+		bool static_ = i.op == IR_CONST || i.op == IR_IMM ||
+			(i.op == IR_COPY && known.has(n + i.a));
+		if (young) known.add(i.dst); else known.remove(i.dst);
+		if (static_) known.add(n + i.dst); else known.remove(n + i.dst);
+	};
+
+	std::vector<IrSet> in = must_forward(IrSet(2 * n), transfer);
+	for (int b : reverse_postorder()){
+		IrSet known = in[b];
+		for (auto &i : blocks[b].code){
+			if (i.op == IR_SETATTR && (!generational || known.has(i.a) || known.has(n + i.b)))
+				i.flags |= IR_NO_BARRIER;
+			transfer(i, known);
+		}
+	}
+}
+
+//
+// Folds the comparison, not or isvoid that computes the condition of a
+// branch into the branch, when it is the last instruction of the block
+// and the branch its only use, so that the Bool is never made.  A
+// branch on an immediate becomes a jump.
+//
+inline void IrFunction::fuse_branches()
+{
+	std::vector<int> uses(temps.size(), 0);
+	for (auto const& b : blocks)
+		for (auto const& i : b.code)
+			i.for_each_use([&](int t){ uses[t]++; });
+
+	for (auto &b : blocks){
+		for (bool changed = true; changed && b.code.size() >= 2; ){
+			changed = false;
+			IrInstr &br = b.code.back();
+			IrInstr &d = b.code[b.code.size() - 2];
+			if (br.op != IR_BRANCH || d.dst != br.a || br.b >= 0 || uses[br.a] != 1) break;
+
+			bool inverted = br.imm == IR_IF_Z;
+			switch (d.op){
+			case IR_LT: case IR_LE: case IR_EQ:
+				br.imm = d.op == IR_LT ? IR_IF_LT : d.op == IR_LE ? IR_IF_LE : IR_IF_EQ;
+				br.a = d.a;
+				br.b = d.b;
+				if (inverted) std::swap(b.succ[0], b.succ[1]);
+				break;
+			case IR_NOT: case IR_ISVOID:
+				br.imm = inverted ? IR_IF_NZ : IR_IF_Z;
+				br.a = d.a;
+				break;
+			case IR_IMM:
+				br.op = IR_JUMP;
+				br.a = -1;
+				if ((d.imm != 0) == inverted) b.succ[0] = b.succ[1];
+				b.succ.pop_back();
+				break;
+			default:
+				continue;
+			}
+			b.code.erase(b.code.end() - 2);
+			changed = true;
+		}
+	}
+	compute_preds();
+}
+
+//
+// Marks the calls whose result is returned as tail calls.  A jump to a
+// block that only returns is replaced by the return first, so that the
+// calls that end the arms of a cond or case are found as well.
+//
+inline void IrFunction::mark_tail_calls()
+{
+	for (auto &b : blocks){
+		if (b.code.empty() || b.code.back().op != IR_JUMP) continue;
+		IrBlock const& to = blocks[b.succ[0]];
+		if (to.code.size() == 1 && to.code[0].op == IR_RETURN){
+			b.code.back() = to.code[0];
+			b.succ.clear();
+		}
+	}
+
+	for (auto &b : blocks){
+		if (b.code.empty() || b.code.back().op != IR_RETURN) continue;
+		// The copies into the returned temporary just before the return.
+		size_t k = b.code.size() - 1;
+		int v = b.code[k].a;
+		while (k > 0 && b.code[k - 1].op == IR_COPY && b.code[k - 1].dst == v)
+			v = b.code[--k].a;
+		if (k == 0 || b.code[k - 1].op != IR_CALL || b.code[k - 1].dst != v) continue;
+
+		b.code.erase(b.code.begin() + k, b.code.end() - 1);
+		b.code[k - 1].flags |= IR_TAIL;
+		b.code[k].flags |= IR_TAIL;
+		b.code[k].a = v;
+	}
+	compute_preds();
+}
+
+inline void IrFunction::dump(std::ostream& s) const
+{
+	static const char *names[] = {
+		"const", "imm", "copy", "getattr", "setattr", "unbox", "box",
+		"add", "sub", "mul", "div", "neg", "lt", "le", "eq", "not",
+		"isvoid", "equals", "new", "checkvoid", "call", "tag",
+		"jump", "branch", "return", "caseabort"
+	};
+	static const char *kinds[] = { "obj", "int", "bool" };
+
+	s << "# " << cls << "." << name << ": " << nformals << " formals, "
+	  << temps.size() << " temporaries\n";
+	for (size_t b = 0; b < blocks.size(); b++){
+		s << "#  B" << b << ":";
+		for (int p : blocks[b].pred) s << " <B" << p;
+		s << '\n';
+		for (auto const& i : blocks[b].code){
+			s << "#\t";
+			if (i.dst >= 0) s << "t" << i.dst << ":" << kinds[temps[i.dst].kind] << " = ";
+			s << names[i.op];
+			if (i.a >= 0) s << " t" << i.a;
+			if (i.b >= 0) s << " t" << i.b;
+			for (int a : i.args) s << " t" << a;
+			if (i.op == IR_IMM || i.op == IR_BOX || i.op == IR_GETATTR || i.op == IR_SETATTR ||
+			    i.op == IR_CALL || i.op == IR_CHECK_VOID || i.op == IR_BRANCH)
+				s << " #" << i.imm;
+			if (i.sym) s << " " << i.sym;
+			if (i.sym2) s << "." << i.sym2;
+			if (i.ref.kind != MipsRef::NONE){ s << " "; i.ref.print(s); }
+			for (int t : blocks[b].succ)
+				if (i.is_terminator()) s << " B" << t;
+			s << '\n';
+		}
+	}
+}
+
+#endif
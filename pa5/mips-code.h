@@ -0,0 +1,557 @@
+//
+// mips-code.h
+//
+// The text of a method or of a Class_init is not written out as it is
+// generated.  The emit_* functions append MipsInstr records to a
+// MipsCode list, which is run through a peephole optimizer and only
+// then printed in the same textual form the emitters used to produce.
+//
+// The peephole pass works on the list of one function and repeats
+// until nothing changes:
+//
+//   - a push followed, after instructions that neither touch $sp nor
+//     the popped register, by a pop becomes a move (or nothing);
+//   - a load from the slot just stored to becomes a move (or nothing);
+//   - adjacent $sp adjustments are merged;
+//   - jumps to jumps are threaded, a conditional branch over a jump is
+//     inverted, jumps to the next instruction, unreachable code and
+//     unused labels are removed;
+//   - writes to registers that are overwritten before being read in the
+//     same basic block are removed, as are moves of a register to
+//     itself.
+//
+// COOL_PEEPHOLE=0 in the environment switches the pass off, to compare
+// the code with and without it.
+//
+// Include after cgen.h, which has no include guard; the operands refer
+// to the constant tables and BoolConst declared there.
+//
+
+#ifndef MIPS_CODE_H
+#define MIPS_CODE_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <deque>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+enum MipsOp {
+	M_NOP, M_COMMENT, M_LABEL,
+	M_LW, M_SW, M_LI, M_LA, M_MOVE, M_NEG,
+	M_ADD, M_ADDU, M_SUB, M_MUL, M_DIV, M_ADDIU, M_SLL,
+	M_JAL, M_JALR, M_J, M_JR, M_RET, M_B,
+	M_BEQZ, M_BNEZ, M_BEQ, M_BNE, M_BLT, M_BLE, M_BGT, M_BGE
+};
+
+//
+// The symbolic operand of an la or jal, printed the way the emit_*_ref
+// functions print it.
+//
+struct MipsRef
+{
+	enum Kind { NONE, NAME, INT, STRING, BOOL, PROTOBJ, DISPTAB, INIT, METHOD } kind;
+	const void *a, *b;
+
+	static MipsRef name(const char *n)           { MipsRef r = { NAME, n, NULL }; return r; }
+	static MipsRef int_const(IntEntry *i)        { MipsRef r = { INT, i, NULL }; return r; }
+	static MipsRef string_const(StringEntry *s)  { MipsRef r = { STRING, s, NULL }; return r; }
+	static MipsRef bool_const(const BoolConst *b){ MipsRef r = { BOOL, b, NULL }; return r; }
+	static MipsRef protobj(Symbol c)             { MipsRef r = { PROTOBJ, c, NULL }; return r; }
+	static MipsRef disptab(Symbol c)             { MipsRef r = { DISPTAB, c, NULL }; return r; }
+	static MipsRef init(Symbol c)                { MipsRef r = { INIT, c, NULL }; return r; }
+	static MipsRef method(Symbol c, Symbol m)    { MipsRef r = { METHOD, c, m }; return r; }
+
+	void print(ostream& s) const
+	{
+		switch (kind){
+		case NAME:    s << (const char *) a; break;
+		case INT:     ((IntEntry *) a)->code_ref(s); break;
+		case STRING:  ((StringEntry *) a)->code_ref(s); break;
+		case BOOL:    ((const BoolConst *) a)->code_ref(s); break;
+		case PROTOBJ: s << (Symbol) a << PROTOBJ_SUFFIX; break;
+		case DISPTAB: s << (Symbol) a << DISPTAB_SUFFIX; break;
+		case INIT:    s << (Symbol) a << CLASSINIT_SUFFIX; break;
+		case METHOD:  s << (Symbol) a << METHOD_SEP << (Symbol) b; break;
+		case NONE:    break;
+		}
+	}
+};
+
+struct MipsInstr
+{
+	MipsOp op;
+	signed char rd, rs, rt;    // register numbers, -1 when unused
+	int imm;                   // immediate, or word offset of lw/sw
+	int label;                 // branch target or label number
+	MipsRef ref;               // la/jal operand
+	const char *text;          // comment
+};
+
+enum { R_ZERO = 0, R_A0 = 4, R_SP = 29, R_FP = 30, R_RA = 31, R_NONE = -1 };
+
+inline int mips_reg(const char *r)
+{
+	if (r == NULL) return R_NONE;
+	int d = r[2] - '0';
+	switch (r[1]){
+	case 'z': return 0;
+	case 'a': return r[2] == 't' ? 1 : 4 + d;
+	case 'v': return 2 + d;
+	case 't': return d < 8 ? 8 + d : 16 + d;
+	case 's': return r[2] == 'p' ? R_SP : 16 + d;
+	case 'k': return 26 + d;
+	case 'g': return 28;
+	case 'f': return R_FP;
+	case 'r': return R_RA;
+	}
+	abort();
+}
+
+inline const char *mips_reg_name(int r)
+{
+	static const char *names[] = {
+		"$zero", "$at", "$v0", "$v1", "$a0", "$a1", "$a2", "$a3",
+		"$t0", "$t1", "$t2", "$t3", "$t4", "$t5", "$t6", "$t7",
+		"$s0", "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7",
+		"$t8", "$t9", "$k0", "$k1", "$gp", "$sp", "$fp", "$ra"
+	};
+	return names[r];
+}
+
+class MipsCode
+{
+	std::vector<MipsInstr> code;
+	std::deque<std::string> notes;     // the text of comments made up on the fly
+
+	static MipsInstr make(MipsOp op, int rd = R_NONE, int rs = R_NONE, int rt = R_NONE, int imm = 0)
+	{
+		MipsInstr i;
+		i.op = op;
+		i.rd = rd; i.rs = rs; i.rt = rt;
+		i.imm = imm;
+		i.label = -1;
+		i.ref.kind = MipsRef::NONE;
+		i.ref.a = i.ref.b = NULL;
+		i.text = NULL;
+		return i;
+	}
+
+	static bool is_branch(MipsOp op) { return op >= M_BEQZ; }
+	static bool is_jump(MipsOp op) { return op == M_B || op == M_J || op == M_JR || op == M_RET; }
+	static bool ends_block(MipsOp op)
+	{
+		return op == M_LABEL || op == M_JAL || op == M_JALR || is_jump(op) || is_branch(op);
+	}
+
+	// Registers written by a straight line instruction, as a bit mask.
+	static unsigned writes(MipsInstr const& i)
+	{
+		switch (i.op){
+		case M_LW: case M_LI: case M_LA: case M_MOVE: case M_NEG:
+		case M_ADD: case M_ADDU: case M_SUB: case M_MUL: case M_DIV:
+		case M_ADDIU: case M_SLL:
+			return 1u << i.rd;
+		default:
+			return 0;
+		}
+	}
+
+	static unsigned reads(MipsInstr const& i)
+	{
+		unsigned m = 0;
+		if (i.rs >= 0) m |= 1u << i.rs;
+		if (i.rt >= 0) m |= 1u << i.rt;
+		return m;
+	}
+
+	// Writes that can be dropped when their result is dead.  div traps
+	// on a zero divisor, so it stays.
+	static bool removable(MipsInstr const& i)
+	{
+		return writes(i) != 0 && i.op != M_DIV &&
+			i.rd != R_SP && i.rd != R_FP && i.rd != R_RA && i.rd != 16;
+	}
+
+	static MipsOp inverse(MipsOp op)
+	{
+		switch (op){
+		case M_BEQZ: return M_BNEZ;
+		case M_BNEZ: return M_BEQZ;
+		case M_BEQ:  return M_BNE;
+		case M_BNE:  return M_BEQ;
+		case M_BLT:  return M_BGE;
+		case M_BGE:  return M_BLT;
+		case M_BLE:  return M_BGT;
+		case M_BGT:  return M_BLE;
+		default:     abort();
+		}
+	}
+
+	// Index of the next instruction after i that is not a comment or
+	// deleted, code.size() if there is none.
+	size_t next(size_t i) const
+	{
+		for (i++; i < code.size(); i++)
+			if (code[i].op != M_COMMENT && code[i].op != M_NOP) return i;
+		return i;
+	}
+
+	bool is_push(size_t i, size_t j) const
+	{
+		return j < code.size() &&
+			code[i].op == M_SW && code[i].rs == R_SP && code[i].imm == 0 &&
+			code[j].op == M_ADDIU && code[j].rd == R_SP && code[j].rs == R_SP && code[j].imm == -4;
+	}
+
+	bool is_pop(size_t i, size_t j) const
+	{
+		return j < code.size() &&
+			code[i].op == M_LW && code[i].rs == R_SP && code[i].imm == 1 &&
+			code[j].op == M_ADDIU && code[j].rd == R_SP && code[j].rs == R_SP && code[j].imm == 4;
+	}
+
+	bool forward_pushes();
+	bool forward_stores();
+	bool merge_sp_adjustments();
+	bool thread_jumps();
+	bool remove_dead_writes();
+	void compact();
+
+public:
+	void add(MipsInstr const& i) { code.push_back(i); }
+
+	void rri(MipsOp op, const char *rd, const char *rs, int imm)
+	{ add(make(op, mips_reg(rd), mips_reg(rs), R_NONE, imm)); }
+
+	void rrr(MipsOp op, const char *rd, const char *rs, const char *rt)
+	{ add(make(op, mips_reg(rd), mips_reg(rs), mips_reg(rt))); }
+
+	void store(const char *src, int offset, const char *base)
+	{ add(make(M_SW, R_NONE, mips_reg(base), mips_reg(src), offset)); }
+
+	void ref(MipsOp op, const char *rd, MipsRef r)
+	{
+		MipsInstr i = make(op, mips_reg(rd));
+		i.ref = r;
+		add(i);
+	}
+
+	void branch(MipsOp op, const char *rs, const char *rt, int imm, int label)
+	{
+		MipsInstr i = make(op, R_NONE, mips_reg(rs), mips_reg(rt), imm);
+		i.label = label;
+		add(i);
+	}
+
+	void add_op(MipsOp op) { add(make(op)); }
+
+	void label(int l)
+	{
+		MipsInstr i = make(M_LABEL);
+		i.label = l;
+		add(i);
+	}
+
+	void comment(const char *text)
+	{
+		MipsInstr i = make(M_COMMENT);
+		i.text = text;
+		add(i);
+	}
+
+	void comment(std::string const& text)
+	{
+		notes.push_back(text);
+		comment(notes.back().c_str());
+	}
+
+	void optimize();
+	void print(ostream& s) const;
+	size_t size() const { return code.size(); }
+};
+
+inline void MipsCode::print(ostream& s) const
+{
+	for (auto const& i : code){
+		switch (i.op){
+		case M_NOP:
+			break;
+		case M_COMMENT:
+			s << "\t# " << i.text << '\n';
+			break;
+		case M_LABEL:
+			s << "label" << i.label << ":\n";
+			break;
+		case M_LW:
+			s << LW << mips_reg_name(i.rd) << " " << i.imm * WORD_SIZE << "(" << mips_reg_name(i.rs) << ")\n";
+			break;
+		case M_SW:
+			s << SW << mips_reg_name(i.rt) << " " << i.imm * WORD_SIZE << "(" << mips_reg_name(i.rs) << ")\n";
+			break;
+		case M_LI:
+			s << LI << mips_reg_name(i.rd) << " " << i.imm << '\n';
+			break;
+		case M_LA:
+			s << LA << mips_reg_name(i.rd) << " "; i.ref.print(s); s << '\n';
+			break;
+		case M_MOVE:
+			s << MOVE << mips_reg_name(i.rd) << " " << mips_reg_name(i.rs) << '\n';
+			break;
+		case M_NEG:
+			s << NEG << mips_reg_name(i.rd) << " " << mips_reg_name(i.rs) << '\n';
+			break;
+		case M_ADD: case M_ADDU: case M_SUB: case M_MUL: case M_DIV: {
+			const char *op = i.op == M_ADD ? ADD : i.op == M_ADDU ? ADDU :
+			                 i.op == M_SUB ? SUB : i.op == M_MUL ? MUL : DIV;
+			s << op << mips_reg_name(i.rd) << " " << mips_reg_name(i.rs) << " " << mips_reg_name(i.rt) << '\n';
+			break;
+		}
+		case M_ADDIU:
+			s << ADDIU << mips_reg_name(i.rd) << " " << mips_reg_name(i.rs) << " " << i.imm << '\n';
+			break;
+		case M_SLL:
+			s << SLL << mips_reg_name(i.rd) << " " << mips_reg_name(i.rs) << " " << i.imm << '\n';
+			break;
+		case M_JAL:
+			s << JAL; i.ref.print(s); s << '\n';
+			break;
+		case M_JALR:
+			s << JALR << "\t" << mips_reg_name(i.rs) << '\n';
+			break;
+		case M_J:
+			s << JUMP; i.ref.print(s); s << '\n';
+			break;
+		case M_JR:
+			s << JR << mips_reg_name(i.rs) << '\n';
+			break;
+		case M_RET:
+			s << RET << '\n';
+			break;
+		case M_B:
+			s << BRANCH << "label" << i.label << '\n';
+			break;
+		default: {
+			const char *op = i.op == M_BEQZ ? BEQZ : i.op == M_BNEZ ? BNEZ :
+			                 i.op == M_BEQ ? BEQ : i.op == M_BNE ? BNE :
+			                 i.op == M_BLT ? BLT : i.op == M_BLE ? BLEQ :
+			                 i.op == M_BGT ? BGT : BGE;
+			s << op << mips_reg_name(i.rs) << " ";
+			if (i.op != M_BEQZ && i.op != M_BNEZ){
+				if (i.rt >= 0) s << mips_reg_name(i.rt) << " ";
+				else s << i.imm << " ";
+			}
+			s << "label" << i.label << '\n';
+		}
+		}
+	}
+}
+
+inline void MipsCode::compact()
+{
+	size_t k = 0;
+	for (size_t i = 0; i < code.size(); i++)
+		if (code[i].op != M_NOP) code[k++] = code[i];
+	code.resize(k);
+}
+
+//
+//   sw R 0($sp); addiu $sp $sp -4; I...; lw R2 4($sp); addiu $sp $sp 4
+//
+// where no I touches $sp or R2 or is a label, branch or call, becomes
+// `move R2 R; I...'.  The pushed word is below every live stack slot,
+// so no I can read it through another register.
+//
+inline bool MipsCode::forward_pushes()
+{
+	bool changed = false;
+	for (size_t i = 0; i < code.size(); i++){
+		size_t j = next(i);
+		if (!is_push(i, j)) continue;
+
+		size_t k = next(j);
+		unsigned touched = 0;
+		while (k < code.size() && !ends_block(code[k].op) && code[k].op != M_SW &&
+		       !((reads(code[k]) | writes(code[k])) & (1u << R_SP))){
+			touched |= reads(code[k]) | writes(code[k]);
+			k = next(k);
+		}
+		size_t l = next(k);
+		if (!is_pop(k, l) || (touched & (1u << code[k].rd))) continue;
+
+		int src = code[i].rt, dst = code[k].rd;
+		code[i] = make(M_MOVE, dst, src);
+		if (src == dst) code[i].op = M_NOP;
+		code[j].op = code[k].op = code[l].op = M_NOP;
+		changed = true;
+	}
+	return changed;
+}
+
+// sw R n(B); lw R2 n(B)  ->  sw R n(B); move R2 R
+inline bool MipsCode::forward_stores()
+{
+	bool changed = false;
+	for (size_t i = 0; i < code.size(); i++){
+		size_t j = next(i);
+		if (j >= code.size() || code[i].op != M_SW || code[j].op != M_LW) continue;
+		if (code[i].rs != code[j].rs || code[i].imm != code[j].imm) continue;
+		int src = code[i].rt, dst = code[j].rd;
+		code[j] = make(M_MOVE, dst, src);
+		if (src == dst) code[j].op = M_NOP;
+		changed = true;
+	}
+	return changed;
+}
+
+inline bool MipsCode::merge_sp_adjustments()
+{
+	bool changed = false;
+	for (size_t i = 0; i < code.size(); i++){
+		MipsInstr &a = code[i];
+		if (a.op != M_ADDIU || a.rd != R_SP || a.rs != R_SP) continue;
+		size_t j = next(i);
+		if (j < code.size() && code[j].op == M_ADDIU && code[j].rd == R_SP && code[j].rs == R_SP){
+			code[j].imm += a.imm;
+			a.op = M_NOP;
+			changed = true;
+		} else if (a.imm == 0){
+			a.op = M_NOP;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+inline bool MipsCode::thread_jumps()
+{
+	bool changed = false;
+
+	std::map<int, size_t> where;
+	for (size_t i = 0; i < code.size(); i++)
+		if (code[i].op == M_LABEL) where[code[i].label] = i;
+
+	// The first real instruction at or after label l.
+	auto target = [&](int l) -> size_t {
+		size_t i = where[l];
+		while (i < code.size() && (code[i].op == M_LABEL || code[i].op == M_COMMENT || code[i].op == M_NOP))
+			i++;
+		return i;
+	};
+
+	std::map<int, int> uses;
+	for (size_t i = 0; i < code.size(); i++){
+		MipsInstr &b = code[i];
+		if (b.op != M_B && !is_branch(b.op)) continue;
+
+		// Jumps to jumps.
+		for (int hops = 0; hops < 8; hops++){
+			size_t t = target(b.label);
+			if (t >= code.size() || code[t].op != M_B || code[t].label == b.label) break;
+			b.label = code[t].label;
+			changed = true;
+		}
+
+		// A jump to the next instruction.
+		size_t n = i + 1;
+		bool falls_through = false;
+		for (; n < code.size() && (code[n].op == M_LABEL || code[n].op == M_COMMENT || code[n].op == M_NOP); n++)
+			if (code[n].op == M_LABEL && code[n].label == b.label) falls_through = true;
+		if (falls_through){
+			b.op = M_NOP;
+			changed = true;
+			continue;
+		}
+
+		// bcond L1; b L2; L1:  ->  b!cond L2; L1:
+		size_t j = next(i);
+		if (is_branch(b.op) && j < code.size() && code[j].op == M_B){
+			size_t k = next(j);
+			bool over = false;
+			for (size_t m = j + 1; m <= k && m < code.size(); m++)
+				if (code[m].op == M_LABEL && code[m].label == b.label) over = true;
+			if (over){
+				b.op = inverse(b.op);
+				b.label = code[j].label;
+				code[j].op = M_NOP;
+				changed = true;
+			}
+		}
+		uses[b.label]++;
+	}
+
+	// Code after an unconditional jump up to the next label is dead.
+	for (size_t i = 0; i < code.size(); i++){
+		if (!is_jump(code[i].op)) continue;
+		for (size_t k = i + 1; k < code.size() && code[k].op != M_LABEL; k++){
+			if (code[k].op != M_NOP && code[k].op != M_COMMENT){
+				code[k].op = M_NOP;
+				changed = true;
+			}
+		}
+	}
+
+	for (auto &i : code){
+		if (i.op == M_LABEL && uses[i.label] == 0){
+			i.op = M_NOP;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+//
+// Backwards over each basic block: a register write nobody reads before
+// the next write is dropped.  Everything is live at the block ends.
+//
+inline bool MipsCode::remove_dead_writes()
+{
+	bool changed = false;
+	unsigned live = ~0u;
+	for (size_t n = code.size(); n-- > 0; ){
+		MipsInstr &i = code[n];
+		if (i.op == M_NOP || i.op == M_COMMENT) continue;
+		if (ends_block(i.op)){
+			live = ~0u;
+			continue;
+		}
+		if (i.op == M_MOVE && i.rd == i.rs){
+			i.op = M_NOP;
+			changed = true;
+			continue;
+		}
+		unsigned w = writes(i);
+		if (removable(i) && !(live & w)){
+			i.op = M_NOP;
+			changed = true;
+			continue;
+		}
+		live = (live & ~w) | reads(i);
+	}
+	return changed;
+}
+
+inline void MipsCode::optimize()
+{
+	static int enabled = -1;
+	if (enabled < 0){
+		const char *e = getenv("COOL_PEEPHOLE");
+		enabled = !(e != NULL && strcmp(e, "0") == 0);
+	}
+	if (!enabled) return;
+
+	for (int round = 0; round < 10; round++){
+		bool changed = forward_pushes();
+		changed |= forward_stores();
+		changed |= merge_sp_adjustments();
+		compact();
+		changed |= thread_jumps();
+		changed |= remove_dead_writes();
+		compact();
+		if (!changed) break;
+	}
+}
+
+#endif
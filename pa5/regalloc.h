@@ -0,0 +1,213 @@
+//
+// regalloc.h
+//
+// Linear scan register allocation of the temporaries of an IrFunction.
+//
+// The blocks are laid out in reverse postorder and the instructions
+// numbered in that order.  Instruction k reads its operands at point
+// 3k, calls out, if it does, at 3k+1 and writes its result at 3k+2.
+// The live range of a temporary is the interval from the first to the
+// last point it is live at, from IrLiveness, so a variable used across
+// a loop back edge covers the whole loop.
+//
+// The intervals are handed out, in order of their start, the registers
+// the stack machine code never touches: $t0, $t4-$t9 and $s1-$s6.
+// When none is free the interval that ends last is spilled, and lives
+// in its frame slot.  Self stays in $s0, and $s7 holds the limit of the
+// heap for the runtime's allocator.
+//
+// Calls clobber the $t registers, and with a garbage collector (-g),
+// which may run in any call, only the objects referenced from the stack
+// are found and moved.  So without a collector an interval that spans a
+// call prefers an $s register, which the callee preserves.  Otherwise
+// it is stored to its frame slot before the call and reloaded after it;
+// saves[] lists these for every call.  Intervals that span no call
+// prefer the $t registers, so that the $s registers a function must save
+// in its prologue are few.  With a collector a raw Int or Bool gets no $s
+// register at all: a callee saves those to its frame, where the
+// collector would take the value for a pointer.  For the same reason a
+// raw temporary is only saved around calls into the runtime, and not to
+// the frame; one that would be spilled, or saved around a call that may
+// run a method, is listed in unsafe[] instead, for the caller to box.
+//
+// Include after ir.h.
+//
+
+#ifndef REGALLOC_H
+#define REGALLOC_H
+
+#include <algorithm>
+#include <vector>
+
+struct RegAlloc
+{
+	std::vector<int> order;                   // blocks in layout order
+	std::vector<int> reg;                     // register of every temporary, -1 if spilled
+	std::vector<int> start, end;              // live interval of every temporary
+	std::vector<std::vector<int> > saves;     // per instruction: temporaries to save around its call
+	std::vector<int> callee_saved;            // $s registers used
+	std::vector<int> unsafe;                  // raw temporaries that would be in the frame, with a collector
+
+	static bool is_callee_saved(int r) { return r >= 16 && r <= 22; }
+	static const int ncaller = 7;             // $t registers handed out
+
+	RegAlloc(IrFunction const& f, IrLiveness const& live, bool gc);
+
+private:
+	std::vector<int> calls;                   // call points, ascending
+	std::vector<char> runs_code;              // per instruction: whether its call may run a method
+	bool gc;
+
+	// Whether a temporary can stay in an $s register across calls.
+	bool preserved() const { return !gc; }
+
+	// Whether t may only be given a $t register.
+	bool raw(IrFunction const& f, int t) const
+	{
+		return gc && f.temps[t].kind != IK_OBJ;
+	}
+
+	bool spans_call(int t) const
+	{
+		auto p = std::upper_bound(calls.begin(), calls.end(), start[t]);
+		return p != calls.end() && *p < end[t];
+	}
+
+	void extend(int t, int point)
+	{
+		if (start[t] < 0 || point < start[t]) start[t] = point;
+		if (point > end[t]) end[t] = point;
+	}
+
+	void intervals(IrFunction const& f, IrLiveness const& live);
+	void scan(IrFunction const& f);
+};
+
+inline void RegAlloc::intervals(IrFunction const& f, IrLiveness const& live)
+{
+	int k = 0;
+	for (int b : order){
+		int first = 3 * k;
+		int last = 3 * (k + f.blocks[b].code.size()) - 1;
+		live.in[b].for_each([&](int t){ extend(t, first); });
+		live.out[b].for_each([&](int t){ extend(t, last); });
+
+		for (auto const& i : f.blocks[b].code){
+			int use = (i.op == IR_BOX && i.calls()) ? 3 * k + 2 : 3 * k;
+			i.for_each_use([&](int t){ extend(t, use); });
+			if (i.dst >= 0) extend(i.dst, 3 * k + 2);
+			if (i.calls()) calls.push_back(3 * k + 1);
+			runs_code.push_back(i.runs_code());
+			k++;
+		}
+	}
+	saves.resize(k);
+}
+
+inline void RegAlloc::scan(IrFunction const& f)
+{
+	static const int caller_regs[ncaller] = { 8, 12, 13, 14, 15, 24, 25 }; // $t0, $t4-$t9
+	static const int callee_regs[] = { 17, 18, 19, 20, 21, 22 };         // $s1-$s6
+	const int ncallee = sizeof callee_regs / sizeof *callee_regs;
+
+	std::vector<int> todo;
+	for (size_t t = 1; t < f.temps.size(); t++)
+		if (start[t] >= 0) todo.push_back(t);
+	std::sort(todo.begin(), todo.end(), [&](int x, int y){
+		return start[x] < start[y] || (start[x] == start[y] && x < y);
+	});
+
+	std::vector<int> active;          // temporaries holding a register
+	unsigned used = 0;                // registers of active, as a bit mask
+	size_t next_call = 0;
+
+	auto expire = [&](int point){
+		for (size_t n = 0; n < active.size(); ){
+			if (end[active[n]] < point){
+				used &= ~(1u << reg[active[n]]);
+				active[n] = active.back();
+				active.pop_back();
+			} else n++;
+		}
+	};
+
+	// Records the registers live across the calls before point.
+	auto pass_calls = [&](int point){
+		for (; next_call < calls.size() && calls[next_call] < point; next_call++){
+			int p = calls[next_call];
+			expire(p);
+			for (int t : active)
+				if (start[t] < p && end[t] > p)
+					saves[p / 3].push_back(t);
+		}
+	};
+
+	for (int t : todo){
+		pass_calls(start[t]);
+		expire(start[t]);
+
+		bool keep = spans_call(t) && preserved();
+		const int *first = keep ? callee_regs : caller_regs;
+		const int *second = keep ? caller_regs : callee_regs;
+		int nfirst = keep ? ncallee : ncaller;
+		int nsecond = raw(f, t) ? 0 : keep ? ncaller : ncallee;
+		int r = -1;
+		for (int n = 0; n < nfirst && r < 0; n++)
+			if (!(used & (1u << first[n]))) r = first[n];
+		for (int n = 0; n < nsecond && r < 0; n++)
+			if (!(used & (1u << second[n]))) r = second[n];
+
+		if (r < 0){
+			// Spill whichever of t and the active intervals whose
+			// register t may have ends last.
+			auto victim = active.end();
+			for (auto p = active.begin(); p != active.end(); ++p)
+				if (!(raw(f, t) && is_callee_saved(reg[*p])) &&
+						(victim == active.end() || end[*p] > end[*victim]))
+					victim = p;
+			if (victim == active.end() || end[*victim] <= end[t]) continue;
+			r = reg[*victim];
+			reg[*victim] = -1;
+			*victim = active.back();
+			active.pop_back();
+		}
+		reg[t] = r;
+		used |= 1u << r;
+		active.push_back(t);
+	}
+	pass_calls(3 * (int) saves.size());
+
+	// A temporary spilled after a call was recorded lives in memory.
+	for (auto &s : saves){
+		s.erase(std::remove_if(s.begin(), s.end(), [&](int t){
+			return reg[t] < 0 || (is_callee_saved(reg[t]) && preserved());
+		}), s.end());
+	}
+
+	for (size_t t = 1; t < f.temps.size(); t++)
+		if (start[t] >= 0 && reg[t] < 0 && raw(f, t)) unsafe.push_back(t);
+	for (size_t k = 0; k < saves.size(); k++)
+		for (int t : saves[k])
+			if (raw(f, t) && runs_code[k]) unsafe.push_back(t);
+	std::sort(unsafe.begin(), unsafe.end());
+	unsafe.erase(std::unique(unsafe.begin(), unsafe.end()), unsafe.end());
+
+	unsigned mask = 0;
+	for (size_t t = 1; t < f.temps.size(); t++)
+		if (reg[t] >= 0 && is_callee_saved(reg[t])) mask |= 1u << reg[t];
+	for (int r = 16; r <= 22; r++)
+		if (mask & (1u << r)) callee_saved.push_back(r);
+}
+
+inline RegAlloc::RegAlloc(IrFunction const& f, IrLiveness const& live, bool collector) :
+	order(f.reverse_postorder()),
+	reg(f.temps.size(), -1),
+	start(f.temps.size(), -1),
+	end(f.temps.size(), -1),
+	gc(collector)
+{
+	intervals(f, live);
+	scan(f);
+}
+
+#endif
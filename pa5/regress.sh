@@ -0,0 +1,90 @@
+#!/bin/sh
+#
+# regress.sh: runs the regression programs against their expected output.
+#
+# Compiles every program with the phases from pa2..pa5, once without -O
+# and once with it, runs each and compares what it prints with the gold
+# file next to it, foo.out for foo.cl:
+#
+#     ./regress.sh [-g] [file.cl ...]
+#
+#     -g      compile both with the generational collector
+#
+# Without files it runs every .cl here that has a .out.  The programs
+# run in spim when SIM=spim, whose banner is dropped, and otherwise in
+# ../bench/mipsim.py, which also faults on a missing write barrier.  A
+# gold file holds what the program prints, then the runtime's message.
+#
+
+PA5=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(dirname "$PA5")
+LEXER=${LEXER:-$ROOT/pa2/lexer}
+PARSER=${PARSER:-$ROOT/pa3/parser}
+SEMANT=${SEMANT:-$ROOT/pa4/semant}
+CGEN=${CGEN:-$PA5/cgen}
+PYTHON=${PYTHON:-python3}
+SIM=${SIM:-mipsim}
+
+gc=
+
+while getopts "g" opt; do
+	case $opt in
+	g) gc=-g ;;
+	*) sed -n '2,/^$/s/^# \{0,1\}//p' "$0" >&2; exit 1 ;;
+	esac
+done
+shift $((OPTIND - 1))
+
+for p in "$LEXER" "$PARSER" "$SEMANT" "$CGEN"; do
+	if [ ! -x "$p" ]; then
+		echo "regress.sh: $p not built" >&2
+		exit 1
+	fi
+done
+
+# The file name is compiled into the void dispatch message, so the
+# programs are compiled from here by their base names.
+cd "$PA5" || exit 1
+if [ $# -eq 0 ]; then
+	for f in *.cl; do
+		[ -f "${f%.cl}.out" ] && set -- "$@" "$f"
+	done
+fi
+
+work=$(mktemp -d "${TMPDIR:-/tmp}/regress.XXXXXX")
+trap 'rm -rf "$work"' EXIT
+
+# run file.s: prints what the program prints.
+run() {
+	if [ "$SIM" = spim ]; then
+		spim -file "$1" < /dev/null | sed '1,/^Loaded: /d'
+	else
+		"$PYTHON" "$ROOT/bench/mipsim.py" "$1" < /dev/null 2> /dev/null
+	fi
+}
+
+failed=0
+for f in "$@"; do
+	f=$(basename "$f")
+	for opt in "" -O; do
+		name="${f%.cl} ${opt:-(no -O)}${gc:+ $gc}"
+		if ! "$LEXER" "$f" | "$PARSER" | "$SEMANT" > "$work/sem"; then
+			echo "FAIL $name: does not compile"
+			failed=$((failed + 1))
+			continue
+		fi
+		$CGEN $opt $gc < "$work/sem" > "$work/s" ||
+			{ echo "FAIL $name: cgen failed"; failed=$((failed + 1)); continue; }
+		run "$work/s" > "$work/got"
+		if diff "${f%.cl}.out" "$work/got" > "$work/diff"; then
+			echo "ok   $name"
+		else
+			echo "FAIL $name"
+			sed 's/^/	/' "$work/diff"
+			failed=$((failed + 1))
+		fi
+	done
+done
+
+[ $failed -eq 0 ] || echo "$failed failed"
+exit $((failed != 0))
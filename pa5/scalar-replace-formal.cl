@@ -0,0 +1,65 @@
+-- A variable that is given a new object may still hold the object it had
+-- before: a formal holds the argument until the assignment, and a copy
+-- taken earlier keeps the old object.  Other overrides f and g so the
+-- calls from main are not inlined.
+--
+-- Expected output:
+-- 42
+-- 5
+-- 43
+
+
+class P
+{
+  v : Int <- 42;
+
+  get() : Int { v };
+
+  set( n : Int ) : P
+  {
+    {
+      v <- n;
+      self;
+    }
+  };
+};
+
+
+class Main inherits IO
+{
+  f( x : P ) : Object
+  {
+    {
+      out_int( x.get() ).out_string( "\n" );
+      x <- new P;
+      x.set( 5 );
+      out_int( x.get() ).out_string( "\n" );
+    }
+  };
+
+  g( x : P ) : Int
+  {
+    let y : P <- x in
+      {
+        x <- new P;
+        x.set( 7 );
+        y.get();
+      }
+  };
+
+  main() : Object
+  {
+    {
+      f( (new P).set( 42 ) );
+      out_int( g( (new P).set( 43 ) ) ).out_string( "\n" );
+    }
+  };
+};
+
+
+class Other inherits Main
+{
+  f( x : P ) : Object { 0 };
+
+  g( x : P ) : Int { 0 };
+};